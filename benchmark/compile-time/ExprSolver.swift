@@ -0,0 +1,70 @@
+//===--- ExprSolver.swift -------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Operator- and literal-heavy expressions. Each expression is kept below the
+// solver's complexity limits on purpose: the point is to measure typical
+// solver work, not time-outs.
+
+func mixedArithmetic(_ x: Double, _ n: Int) -> Double {
+  let a = 1 + 2 * 3 - 4 / 2 + Double(n) * 0.5
+  let b = x * x + 2.0 * x + 1.0 - a / (x + 1.0)
+  let c = (b + a) * (b - a) / (1.0 + abs(b))
+  return a + b + c
+}
+
+func literalFolding() -> [Int] {
+  let values = [1 + 2, 2 * 3, 4 - 1, 8 / 2, 3 % 2, 1 << 4, 255 >> 2]
+  return values.map { $0 * 2 + 1 }.filter { $0 > 4 }
+}
+
+func closuresAndOptionals(_ input: [Int?]) -> Int {
+  let sum = input
+    .flatMap { $0 }
+    .map { $0 * $0 }
+    .reduce(0) { $0 + $1 }
+  let bonus = input.first.flatMap { $0 }.map { $0 + 1 } ?? 0
+  return sum + bonus
+}
+
+func stringInterpolationHeavy(_ name: String, _ count: Int) -> String {
+  let header = "name=\(name) count=\(count) ratio=\(Double(count) / 7.0)"
+  let body = (0..<count).map { "item \($0): \($0 * $0)" }
+  return header + body.joined(separator: ", ")
+}
+
+func ternaryChains(_ n: Int) -> Int {
+  let category = n < 0 ? -1 : n == 0 ? 0 : n < 10 ? 1 : n < 100 ? 2 : 3
+  let weight = category == 0 ? 0.0 : category < 2 ? 0.5 : 1.5
+  return Int(Double(n) * weight) + category
+}
+
+func tupleDestructuring(_ pairs: [(Int, Double)]) -> (Int, Double) {
+  var (total, weight) = (0, 0.0)
+  for (count, value) in pairs {
+    total += count
+    weight += value * Double(count)
+  }
+  return (total, total == 0 ? 0.0 : weight / Double(total))
+}
+
+func comparisonChains(_ a: Int, _ b: Int, _ c: Int) -> Bool {
+  return (a < b && b < c) || (a > b && b > c) || (a == b && b != c)
+    || (a + b > c && b + c > a && a + c > b)
+}
+
+func dictionaryLiterals() -> [String: Int] {
+  return [
+    "one": 1, "two": 1 + 1, "three": 1 + 2,
+    "four": 2 * 2, "five": 10 / 2, "six": 2 * 3,
+    "seven": 14 >> 1, "eight": 1 << 3, "nine": 3 * 3,
+  ]
+}
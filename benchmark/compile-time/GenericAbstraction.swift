@@ -0,0 +1,89 @@
+//===--- GenericAbstraction.swift -----------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// Protocols with associated types, constrained extensions and generic
+// composition, exercising generic signature construction and conformance
+// checking.
+
+protocol Producer {
+  associatedtype Output
+  func produce() -> Output
+}
+
+protocol Transformer {
+  associatedtype Input
+  associatedtype Result
+  func transform(_ value: Input) -> Result
+}
+
+protocol Consumer {
+  associatedtype Input
+  mutating func consume(_ value: Input)
+}
+
+struct ConstantProducer<T>: Producer {
+  let value: T
+  func produce() -> T { return value }
+}
+
+struct MapTransformer<A, B>: Transformer {
+  let body: (A) -> B
+  func transform(_ value: A) -> B { return body(value) }
+}
+
+struct SinkConsumer<T>: Consumer {
+  var values: [T] = []
+  mutating func consume(_ value: T) { values.append(value) }
+}
+
+struct Pipeline<P: Producer, T: Transformer, C: Consumer>
+    where T.Input == P.Output, C.Input == T.Result {
+  let producer: P
+  let transformer: T
+  var consumer: C
+
+  mutating func run(times: Int) {
+    for _ in 0..<times {
+      consumer.consume(transformer.transform(producer.produce()))
+    }
+  }
+}
+
+extension Pipeline where P.Output: Comparable {
+  func isOrdered(_ a: P.Output, _ b: P.Output) -> Bool { return a < b }
+}
+
+extension Sequence where Iterator.Element: Producer {
+  func produceAll() -> [Iterator.Element.Output] {
+    return map { $0.produce() }
+  }
+}
+
+func makeIntPipeline() -> Pipeline<
+    ConstantProducer<Int>, MapTransformer<Int, String>, SinkConsumer<String>> {
+  return Pipeline(
+    producer: ConstantProducer(value: 42),
+    transformer: MapTransformer(body: { "\($0)" }),
+    consumer: SinkConsumer())
+}
+
+func compose<A: Transformer, B: Transformer>(_ a: A, _ b: B)
+    -> MapTransformer<A.Input, B.Result> where A.Result == B.Input {
+  return MapTransformer(body: { b.transform(a.transform($0)) })
+}
+
+func drain<P: Producer, C: Consumer>(_ p: P, into c: inout C, count: Int)
+    where C.Input == P.Output {
+  for _ in 0..<count {
+    c.consume(p.produce())
+  }
+}
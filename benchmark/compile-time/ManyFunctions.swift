@@ -0,0 +1,615 @@
+//===--- ManyFunctions.swift ----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// A large number of small, independent functions with simple bodies,
+// exercising the per-declaration costs of the pipeline rather than any one
+// expensive construct.
+
+func compute000(_ x: Int) -> Int {
+  let y = x &+ 0
+  return y &* 3 &- x
+}
+
+func compute001(_ x: Int) -> Int {
+  let y = x &+ 1
+  return y &* 3 &- x
+}
+
+func compute002(_ x: Int) -> Int {
+  let y = x &+ 2
+  return y &* 3 &- x
+}
+
+func compute003(_ x: Int) -> Int {
+  let y = x &+ 3
+  return y &* 3 &- x
+}
+
+func compute004(_ x: Int) -> Int {
+  let y = x &+ 4
+  return y &* 3 &- x
+}
+
+func compute005(_ x: Int) -> Int {
+  let y = x &+ 5
+  return y &* 3 &- x
+}
+
+func compute006(_ x: Int) -> Int {
+  let y = x &+ 6
+  return y &* 3 &- x
+}
+
+func compute007(_ x: Int) -> Int {
+  let y = x &+ 7
+  return y &* 3 &- x
+}
+
+func compute008(_ x: Int) -> Int {
+  let y = x &+ 8
+  return y &* 3 &- x
+}
+
+func compute009(_ x: Int) -> Int {
+  let y = x &+ 9
+  return y &* 3 &- x
+}
+
+func compute010(_ x: Int) -> Int {
+  let y = x &+ 10
+  return y &* 3 &- x
+}
+
+func compute011(_ x: Int) -> Int {
+  let y = x &+ 11
+  return y &* 3 &- x
+}
+
+func compute012(_ x: Int) -> Int {
+  let y = x &+ 12
+  return y &* 3 &- x
+}
+
+func compute013(_ x: Int) -> Int {
+  let y = x &+ 13
+  return y &* 3 &- x
+}
+
+func compute014(_ x: Int) -> Int {
+  let y = x &+ 14
+  return y &* 3 &- x
+}
+
+func compute015(_ x: Int) -> Int {
+  let y = x &+ 15
+  return y &* 3 &- x
+}
+
+func compute016(_ x: Int) -> Int {
+  let y = x &+ 16
+  return y &* 3 &- x
+}
+
+func compute017(_ x: Int) -> Int {
+  let y = x &+ 17
+  return y &* 3 &- x
+}
+
+func compute018(_ x: Int) -> Int {
+  let y = x &+ 18
+  return y &* 3 &- x
+}
+
+func compute019(_ x: Int) -> Int {
+  let y = x &+ 19
+  return y &* 3 &- x
+}
+
+func compute020(_ x: Int) -> Int {
+  let y = x &+ 20
+  return y &* 3 &- x
+}
+
+func compute021(_ x: Int) -> Int {
+  let y = x &+ 21
+  return y &* 3 &- x
+}
+
+func compute022(_ x: Int) -> Int {
+  let y = x &+ 22
+  return y &* 3 &- x
+}
+
+func compute023(_ x: Int) -> Int {
+  let y = x &+ 23
+  return y &* 3 &- x
+}
+
+func compute024(_ x: Int) -> Int {
+  let y = x &+ 24
+  return y &* 3 &- x
+}
+
+func compute025(_ x: Int) -> Int {
+  let y = x &+ 25
+  return y &* 3 &- x
+}
+
+func compute026(_ x: Int) -> Int {
+  let y = x &+ 26
+  return y &* 3 &- x
+}
+
+func compute027(_ x: Int) -> Int {
+  let y = x &+ 27
+  return y &* 3 &- x
+}
+
+func compute028(_ x: Int) -> Int {
+  let y = x &+ 28
+  return y &* 3 &- x
+}
+
+func compute029(_ x: Int) -> Int {
+  let y = x &+ 29
+  return y &* 3 &- x
+}
+
+func compute030(_ x: Int) -> Int {
+  let y = x &+ 30
+  return y &* 3 &- x
+}
+
+func compute031(_ x: Int) -> Int {
+  let y = x &+ 31
+  return y &* 3 &- x
+}
+
+func compute032(_ x: Int) -> Int {
+  let y = x &+ 32
+  return y &* 3 &- x
+}
+
+func compute033(_ x: Int) -> Int {
+  let y = x &+ 33
+  return y &* 3 &- x
+}
+
+func compute034(_ x: Int) -> Int {
+  let y = x &+ 34
+  return y &* 3 &- x
+}
+
+func compute035(_ x: Int) -> Int {
+  let y = x &+ 35
+  return y &* 3 &- x
+}
+
+func compute036(_ x: Int) -> Int {
+  let y = x &+ 36
+  return y &* 3 &- x
+}
+
+func compute037(_ x: Int) -> Int {
+  let y = x &+ 37
+  return y &* 3 &- x
+}
+
+func compute038(_ x: Int) -> Int {
+  let y = x &+ 38
+  return y &* 3 &- x
+}
+
+func compute039(_ x: Int) -> Int {
+  let y = x &+ 39
+  return y &* 3 &- x
+}
+
+func compute040(_ x: Int) -> Int {
+  let y = x &+ 40
+  return y &* 3 &- x
+}
+
+func compute041(_ x: Int) -> Int {
+  let y = x &+ 41
+  return y &* 3 &- x
+}
+
+func compute042(_ x: Int) -> Int {
+  let y = x &+ 42
+  return y &* 3 &- x
+}
+
+func compute043(_ x: Int) -> Int {
+  let y = x &+ 43
+  return y &* 3 &- x
+}
+
+func compute044(_ x: Int) -> Int {
+  let y = x &+ 44
+  return y &* 3 &- x
+}
+
+func compute045(_ x: Int) -> Int {
+  let y = x &+ 45
+  return y &* 3 &- x
+}
+
+func compute046(_ x: Int) -> Int {
+  let y = x &+ 46
+  return y &* 3 &- x
+}
+
+func compute047(_ x: Int) -> Int {
+  let y = x &+ 47
+  return y &* 3 &- x
+}
+
+func compute048(_ x: Int) -> Int {
+  let y = x &+ 48
+  return y &* 3 &- x
+}
+
+func compute049(_ x: Int) -> Int {
+  let y = x &+ 49
+  return y &* 3 &- x
+}
+
+func compute050(_ x: Int) -> Int {
+  let y = x &+ 50
+  return y &* 3 &- x
+}
+
+func compute051(_ x: Int) -> Int {
+  let y = x &+ 51
+  return y &* 3 &- x
+}
+
+func compute052(_ x: Int) -> Int {
+  let y = x &+ 52
+  return y &* 3 &- x
+}
+
+func compute053(_ x: Int) -> Int {
+  let y = x &+ 53
+  return y &* 3 &- x
+}
+
+func compute054(_ x: Int) -> Int {
+  let y = x &+ 54
+  return y &* 3 &- x
+}
+
+func compute055(_ x: Int) -> Int {
+  let y = x &+ 55
+  return y &* 3 &- x
+}
+
+func compute056(_ x: Int) -> Int {
+  let y = x &+ 56
+  return y &* 3 &- x
+}
+
+func compute057(_ x: Int) -> Int {
+  let y = x &+ 57
+  return y &* 3 &- x
+}
+
+func compute058(_ x: Int) -> Int {
+  let y = x &+ 58
+  return y &* 3 &- x
+}
+
+func compute059(_ x: Int) -> Int {
+  let y = x &+ 59
+  return y &* 3 &- x
+}
+
+func compute060(_ x: Int) -> Int {
+  let y = x &+ 60
+  return y &* 3 &- x
+}
+
+func compute061(_ x: Int) -> Int {
+  let y = x &+ 61
+  return y &* 3 &- x
+}
+
+func compute062(_ x: Int) -> Int {
+  let y = x &+ 62
+  return y &* 3 &- x
+}
+
+func compute063(_ x: Int) -> Int {
+  let y = x &+ 63
+  return y &* 3 &- x
+}
+
+func compute064(_ x: Int) -> Int {
+  let y = x &+ 64
+  return y &* 3 &- x
+}
+
+func compute065(_ x: Int) -> Int {
+  let y = x &+ 65
+  return y &* 3 &- x
+}
+
+func compute066(_ x: Int) -> Int {
+  let y = x &+ 66
+  return y &* 3 &- x
+}
+
+func compute067(_ x: Int) -> Int {
+  let y = x &+ 67
+  return y &* 3 &- x
+}
+
+func compute068(_ x: Int) -> Int {
+  let y = x &+ 68
+  return y &* 3 &- x
+}
+
+func compute069(_ x: Int) -> Int {
+  let y = x &+ 69
+  return y &* 3 &- x
+}
+
+func compute070(_ x: Int) -> Int {
+  let y = x &+ 70
+  return y &* 3 &- x
+}
+
+func compute071(_ x: Int) -> Int {
+  let y = x &+ 71
+  return y &* 3 &- x
+}
+
+func compute072(_ x: Int) -> Int {
+  let y = x &+ 72
+  return y &* 3 &- x
+}
+
+func compute073(_ x: Int) -> Int {
+  let y = x &+ 73
+  return y &* 3 &- x
+}
+
+func compute074(_ x: Int) -> Int {
+  let y = x &+ 74
+  return y &* 3 &- x
+}
+
+func compute075(_ x: Int) -> Int {
+  let y = x &+ 75
+  return y &* 3 &- x
+}
+
+func compute076(_ x: Int) -> Int {
+  let y = x &+ 76
+  return y &* 3 &- x
+}
+
+func compute077(_ x: Int) -> Int {
+  let y = x &+ 77
+  return y &* 3 &- x
+}
+
+func compute078(_ x: Int) -> Int {
+  let y = x &+ 78
+  return y &* 3 &- x
+}
+
+func compute079(_ x: Int) -> Int {
+  let y = x &+ 79
+  return y &* 3 &- x
+}
+
+func compute080(_ x: Int) -> Int {
+  let y = x &+ 80
+  return y &* 3 &- x
+}
+
+func compute081(_ x: Int) -> Int {
+  let y = x &+ 81
+  return y &* 3 &- x
+}
+
+func compute082(_ x: Int) -> Int {
+  let y = x &+ 82
+  return y &* 3 &- x
+}
+
+func compute083(_ x: Int) -> Int {
+  let y = x &+ 83
+  return y &* 3 &- x
+}
+
+func compute084(_ x: Int) -> Int {
+  let y = x &+ 84
+  return y &* 3 &- x
+}
+
+func compute085(_ x: Int) -> Int {
+  let y = x &+ 85
+  return y &* 3 &- x
+}
+
+func compute086(_ x: Int) -> Int {
+  let y = x &+ 86
+  return y &* 3 &- x
+}
+
+func compute087(_ x: Int) -> Int {
+  let y = x &+ 87
+  return y &* 3 &- x
+}
+
+func compute088(_ x: Int) -> Int {
+  let y = x &+ 88
+  return y &* 3 &- x
+}
+
+func compute089(_ x: Int) -> Int {
+  let y = x &+ 89
+  return y &* 3 &- x
+}
+
+func compute090(_ x: Int) -> Int {
+  let y = x &+ 90
+  return y &* 3 &- x
+}
+
+func compute091(_ x: Int) -> Int {
+  let y = x &+ 91
+  return y &* 3 &- x
+}
+
+func compute092(_ x: Int) -> Int {
+  let y = x &+ 92
+  return y &* 3 &- x
+}
+
+func compute093(_ x: Int) -> Int {
+  let y = x &+ 93
+  return y &* 3 &- x
+}
+
+func compute094(_ x: Int) -> Int {
+  let y = x &+ 94
+  return y &* 3 &- x
+}
+
+func compute095(_ x: Int) -> Int {
+  let y = x &+ 95
+  return y &* 3 &- x
+}
+
+func compute096(_ x: Int) -> Int {
+  let y = x &+ 96
+  return y &* 3 &- x
+}
+
+func compute097(_ x: Int) -> Int {
+  let y = x &+ 97
+  return y &* 3 &- x
+}
+
+func compute098(_ x: Int) -> Int {
+  let y = x &+ 98
+  return y &* 3 &- x
+}
+
+func compute099(_ x: Int) -> Int {
+  let y = x &+ 99
+  return y &* 3 &- x
+}
+
+func compute100(_ x: Int) -> Int {
+  let y = x &+ 100
+  return y &* 3 &- x
+}
+
+func compute101(_ x: Int) -> Int {
+  let y = x &+ 101
+  return y &* 3 &- x
+}
+
+func compute102(_ x: Int) -> Int {
+  let y = x &+ 102
+  return y &* 3 &- x
+}
+
+func compute103(_ x: Int) -> Int {
+  let y = x &+ 103
+  return y &* 3 &- x
+}
+
+func compute104(_ x: Int) -> Int {
+  let y = x &+ 104
+  return y &* 3 &- x
+}
+
+func compute105(_ x: Int) -> Int {
+  let y = x &+ 105
+  return y &* 3 &- x
+}
+
+func compute106(_ x: Int) -> Int {
+  let y = x &+ 106
+  return y &* 3 &- x
+}
+
+func compute107(_ x: Int) -> Int {
+  let y = x &+ 107
+  return y &* 3 &- x
+}
+
+func compute108(_ x: Int) -> Int {
+  let y = x &+ 108
+  return y &* 3 &- x
+}
+
+func compute109(_ x: Int) -> Int {
+  let y = x &+ 109
+  return y &* 3 &- x
+}
+
+func compute110(_ x: Int) -> Int {
+  let y = x &+ 110
+  return y &* 3 &- x
+}
+
+func compute111(_ x: Int) -> Int {
+  let y = x &+ 111
+  return y &* 3 &- x
+}
+
+func compute112(_ x: Int) -> Int {
+  let y = x &+ 112
+  return y &* 3 &- x
+}
+
+func compute113(_ x: Int) -> Int {
+  let y = x &+ 113
+  return y &* 3 &- x
+}
+
+func compute114(_ x: Int) -> Int {
+  let y = x &+ 114
+  return y &* 3 &- x
+}
+
+func compute115(_ x: Int) -> Int {
+  let y = x &+ 115
+  return y &* 3 &- x
+}
+
+func compute116(_ x: Int) -> Int {
+  let y = x &+ 116
+  return y &* 3 &- x
+}
+
+func compute117(_ x: Int) -> Int {
+  let y = x &+ 117
+  return y &* 3 &- x
+}
+
+func compute118(_ x: Int) -> Int {
+  let y = x &+ 118
+  return y &* 3 &- x
+}
+
+func compute119(_ x: Int) -> Int {
+  let y = x &+ 119
+  return y &* 3 &- x
+}
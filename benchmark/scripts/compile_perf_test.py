@@ -0,0 +1,144 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+# ===--- compile_perf_test.py --------------------------------------------===//
+#
+#  This source file is part of the Swift.org open source project
+#
+#  Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+#  Licensed under Apache License v2.0 with Runtime Library Exception
+#
+#  See https://swift.org/LICENSE.txt for license information
+#  See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+#
+# ===---------------------------------------------------------------------===//
+#
+# Measures compile time of the sources in the compile-time corpus
+# (benchmark/compile-time) and reports results in the same log format the
+# runtime benchmark drivers emit:
+#
+#     #,TEST,SAMPLES,MIN(μs),MAX(μs),MEAN(μs),SD(μs),MEDIAN(μs)
+#
+# which means baselines can be compared with the existing
+# compare_perf_tests.py, e.g.:
+#
+#     compile_perf_test.py --swiftc $OLD/swiftc -o old.log
+#     compile_perf_test.py --swiftc $NEW/swiftc -o new.log
+#     compare_perf_tests.py --old-file old.log --new-file new.log
+#
+# Pass --stats-output-dir to additionally collect UnifiedStatsReporter
+# JSON for every compilation, for digging into *what* regressed.
+#
+# ===---------------------------------------------------------------------===//
+
+from __future__ import print_function
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from math import sqrt
+
+MODE_FLAGS = {
+    'typecheck': ['-typecheck'],
+    'onone': ['-c', '-Onone'],
+    'O': ['-c', '-O'],
+}
+
+
+def measure_once(swiftc, source, mode, extra_args, tmp_dir):
+    args = [swiftc] + MODE_FLAGS[mode] + extra_args
+    if mode != 'typecheck':
+        args += ['-o', os.path.join(tmp_dir, 'out.o')]
+    args.append(source)
+    start = time.time()
+    ret = subprocess.call(args)
+    elapsed = time.time() - start
+    if ret != 0:
+        print('error: compilation failed: ' + ' '.join(args), file=sys.stderr)
+        sys.exit(1)
+    return int(elapsed * 1e6)  # microseconds, like the runtime drivers
+
+
+def run_test(swiftc, source, mode, samples, extra_args):
+    times = []
+    tmp_dir = tempfile.mkdtemp()
+    try:
+        for _ in range(samples):
+            times.append(measure_once(swiftc, source, mode, extra_args,
+                                      tmp_dir))
+    finally:
+        shutil.rmtree(tmp_dir)
+    times.sort()
+    mean = sum(times) // len(times)
+    if len(times) > 1:
+        variance = (sum((t - mean) ** 2 for t in times) // (len(times) - 1))
+    else:
+        variance = 0
+    median = times[len(times) // 2]
+    return (len(times), times[0], times[-1], mean, int(sqrt(variance)),
+            median)
+
+
+def main():
+    default_corpus = os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), '..', 'compile-time')
+    parser = argparse.ArgumentParser(
+        description='Measure compile time over the compile-time corpus.')
+    parser.add_argument('--swiftc', required=True,
+                        help='path to the swiftc to measure')
+    parser.add_argument('--corpus', default=default_corpus,
+                        help='directory of .swift sources to compile '
+                             '(default: benchmark/compile-time)')
+    parser.add_argument('--iterations', type=int, default=10,
+                        help='number of samples per source and mode')
+    parser.add_argument('--modes', default='typecheck,onone,O',
+                        help='comma-separated subset of: typecheck,onone,O')
+    parser.add_argument('--stats-output-dir',
+                        help='also pass -stats-output-dir to each '
+                             'compilation, collecting stats JSON there')
+    parser.add_argument('-o', dest='output',
+                        help='write the log to this file (default: stdout)')
+    args = parser.parse_args()
+
+    modes = args.modes.split(',')
+    for mode in modes:
+        if mode not in MODE_FLAGS:
+            parser.error('unknown mode: ' + mode)
+
+    extra_args = []
+    if args.stats_output_dir:
+        if not os.path.isdir(args.stats_output_dir):
+            os.makedirs(args.stats_output_dir)
+        extra_args += ['-Xfrontend', '-stats-output-dir',
+                       '-Xfrontend', args.stats_output_dir]
+
+    sources = sorted(glob.glob(os.path.join(args.corpus, '*.swift')))
+    if not sources:
+        print('error: no .swift sources in ' + args.corpus, file=sys.stderr)
+        return 1
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    print('#,TEST,SAMPLES,MIN(us),MAX(us),MEAN(us),SD(us),MEDIAN(us)',
+          file=out)
+    ordinal = 1
+    for source in sources:
+        stem = os.path.splitext(os.path.basename(source))[0]
+        for mode in modes:
+            result = run_test(args.swiftc, source, mode, args.iterations,
+                              extra_args)
+            name = 'CompileTime.{}.{}'.format(stem, mode)
+            print(','.join(str(v) for v in (ordinal, name) + result),
+                  file=out)
+            ordinal += 1
+    if args.output:
+        out.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
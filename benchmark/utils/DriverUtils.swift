@@ -214,6 +214,19 @@ func internalMedian(_ inputs: [UInt64]) -> UInt64 {
   return inputs.sorted()[inputs.count / 2]
 }
 
+// The memory dimension we have today is MAX_RSS: Benchmark_Driver wraps
+// each benchmark in rusage instrumentation and compare_perf_tests.py
+// carries it on every parsed result. Per-run allocation or retain counts
+// would be more diagnostic but cannot come from the hooks below: they are
+// only present in runtimes built with SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
+// (the Benchmark_RuntimeLeaksRunner configuration), and what
+// stopTrackingObjects returns is the number of tracked objects still
+// live — a leak count, not allocation volume. Counting mallocs needs
+// interposition on the runtime allocator entry points in a default
+// runtime build, and any new per-benchmark metric also needs a column in
+// the positional CSV log plus its own threshold plumbing in
+// compare_perf_tests.py (whose comparisons today are keyed off MIN
+// runtime only). See also the note on PMU counters below.
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
 
 @_silgen_name("swift_leaks_startTrackingObjects")
@@ -223,6 +236,17 @@ func stopTrackingObjects(_: UnsafeMutableRawPointer) -> Int
 
 #endif
 
+// On sampling PMU counters (cycles, instructions, branch/L1d misses)
+// alongside wall time: both platform routes need more than this harness can
+// carry on its own. Linux's perf_event_open has no Glibc-module binding, so
+// it needs a C shim built into every benchmark executable, plus perf_event
+// paranoid-level handling; Darwin's kpc interface is private and requires
+// root. The reporting side is also load-bearing: the log format is
+// positional CSV shared with compare_perf_tests.py and Benchmark_Driver, so
+// extra per-sample columns are a coordinated format revision, not a local
+// change. Until someone takes that on, the supported ways to reduce noise
+// are more samples (--num-samples), the adaptive iteration scaling below,
+// and Benchmark_Driver's rusage-based MAX_RSS instrumentation.
 #if os(Linux)
 class Timer {
   typealias TimeT = timespec
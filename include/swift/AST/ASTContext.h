@@ -108,6 +108,15 @@ namespace swift {
   enum class KnownProtocolKind : uint8_t;
 
 /// \brief The arena in which a particular ASTContext allocation will go.
+///
+/// There is deliberately no finer-grained arena for function-body ASTs,
+/// although they dominate the permanent arena's footprint and are dead once
+/// IRGen has consumed them: body allocations interleave with interned types
+/// and synthesized declarations that must outlive the body, a bump allocator
+/// cannot free one without the other, and SIL debug locations keep pointing
+/// into body ASTs (including inlined copies) until all of IRGen completes.
+/// The recovery point for that memory is CompilerInstance::freeContextAndSIL,
+/// which drops the whole context once an IR module exists.
 enum class AllocationArena {
   /// \brief The permanent arena, which is tied to the lifetime of
   /// the ASTContext.
@@ -267,6 +276,24 @@ public:
   llvm::BumpPtrAllocator &
   getAllocator(AllocationArena arena = AllocationArena::Permanent) const;
 
+  /// \brief Prepare the context for AST creation from multiple threads, or
+  /// return it to single-threaded operation.
+  ///
+  /// While enabled, identifier uniquing takes a lock per table shard, and
+  /// each worker thread should install its own allocator so that
+  /// permanent-arena allocations it performs do not race on the shared
+  /// allocator.
+  void setParallelParsingEnabled(bool enabled);
+
+  /// \brief Give the calling thread its own permanent-arena slab allocator
+  /// for the duration of parallel parsing.  The allocator is owned by the
+  /// context and lives as long as it does, since the AST it backs outlives
+  /// the parse phase.
+  void installThreadAllocator();
+
+  /// \brief Detach the calling thread's permanent-arena allocator.
+  void uninstallThreadAllocator();
+
   /// Allocate - Allocate memory from the ASTContext bump pointer.
   void *Allocate(unsigned long bytes, unsigned alignment,
                  AllocationArena arena = AllocationArena::Permanent) const {
@@ -713,6 +740,16 @@ public:
   std::vector<ValueDecl*>
   takeDelayedMissingWitnesses(NormalProtocolConformance *conformance);
 
+  /// Retrieve a uniqued, permanently-allocated copy of the given
+  /// substitution list.
+  ///
+  /// Identical substitution lists share a single allocation, so the results
+  /// can be compared for equality by pointer. Lists whose replacement types
+  /// involve type variables are not uniqued, since they do not outlive the
+  /// constraint system that created them; such lists are copied into the
+  /// appropriate arena instead.
+  SubstitutionList getUniquedSubstitutionList(SubstitutionList subs);
+
   /// \brief Produce a specialized conformance, which takes a generic
   /// conformance and substitutions written in terms of the generic
   /// conformance's signature.
@@ -850,6 +887,51 @@ public:
                                        GenericSignature *sig,
                                        ModuleDecl &module);
 
+  /// Look up the memoized result of canonicalizing the given type relative
+  /// to the generic signature the given builder was created for, or return
+  /// a null type if it has not been computed yet.
+  Type getCachedCanonicalTypeInContext(GenericSignatureBuilder *builder,
+                                       CanType type);
+
+  /// Record the result of canonicalizing the given type relative to the
+  /// generic signature the given builder was created for.
+  void recordCanonicalTypeInContext(GenericSignatureBuilder *builder,
+                                    CanType type, CanType canonicalType);
+
+  /// Look up the memoized result of a qualified name lookup into the given
+  /// module, appending the cached declarations to \p results on a hit.
+  ///
+  /// \param queryKind An opaque discriminator for the lookup and resolution
+  /// kinds of the query, supplied by the caller.
+  ///
+  /// Entries are invalidated whenever the generation count is bumped, since
+  /// newly-loaded modules can introduce declarations into existing ones.
+  ///
+  /// \returns true if a still-valid cached result was found.
+  bool getCachedModuleLookupResult(ModuleDecl *module, DeclName name,
+                                   const DeclContext *moduleScopeContext,
+                                   unsigned queryKind,
+                                   SmallVectorImpl<ValueDecl *> &results);
+
+  /// Record the result of a qualified name lookup into the given module.
+  /// The caller is responsible for only recording queries whose results
+  /// cannot change within a generation.
+  void recordModuleLookupResult(ModuleDecl *module, DeclName name,
+                                const DeclContext *moduleScopeContext,
+                                unsigned queryKind,
+                                ArrayRef<ValueDecl *> results);
+
+  /// Look up the memoized mangling of the given declaration, where
+  /// \p manglingKey discriminates the mangler entry point and its flags.
+  ///
+  /// \returns an empty string if no mangling has been recorded.
+  StringRef getCachedMangledName(const Decl *decl, unsigned manglingKey) const;
+
+  /// Record the mangled name produced for the given declaration and query.
+  /// The string is copied into the permanent arena.
+  void recordMangledName(const Decl *decl, unsigned manglingKey,
+                         StringRef mangledName);
+
   /// Retrieve the inherited name set for the given class.
   const InheritedNameSet *getAllPropertyNames(ClassDecl *classDecl,
                                               bool forInstance);
@@ -22,6 +22,7 @@
 #include "swift/AST/TypeLoc.h"
 #include "swift/AST/DeclNameLoc.h"
 #include "swift/AST/DiagnosticConsumer.h"
+#include "llvm/Support/Mutex.h"
 
 namespace swift {
   class Decl;
@@ -536,9 +537,28 @@ namespace swift {
     /// emitted once all transactions have closed.
     unsigned TransactionCount = 0;
 
+    /// \brief Whether diagnostics may currently be emitted from multiple
+    /// threads.
+    bool ParallelEmissionEnabled = false;
+
+    /// \brief Serializes diagnostic emission while multiple threads are
+    /// active.  Held from \c diagnose() until the in-flight diagnostic is
+    /// flushed.
+    llvm::sys::Mutex ParallelEmissionMutex;
+
     friend class InFlightDiagnostic;
     friend class DiagnosticTransaction;
-    
+
+    /// \brief Begin a new active diagnostic, taking the emission lock when
+    /// diagnostics may arrive from multiple threads.  The lock is released
+    /// by \c flushActiveDiagnostic().
+    void beginActiveDiagnostic(Diagnostic &&D) {
+      if (ParallelEmissionEnabled)
+        ParallelEmissionMutex.lock();
+      assert(!ActiveDiagnostic && "Already have an active diagnostic");
+      ActiveDiagnostic = std::move(D);
+    }
+
   public:
     explicit DiagnosticEngine(SourceManager &SourceMgr)
       : SourceMgr(SourceMgr), ActiveDiagnostic() {
@@ -551,6 +571,12 @@ namespace swift {
       return state.hasFatalErrorOccurred();
     }
 
+    /// \brief Whether diagnostics may be emitted from multiple threads.
+    /// While enabled, emission is serialized on a mutex.
+    void setParallelEmissionEnabled(bool enabled) {
+      ParallelEmissionEnabled = enabled;
+    }
+
     void setShowDiagnosticsAfterFatalError(bool val = true) {
       state.setShowDiagnosticsAfterFatalError(val);
     }
@@ -604,10 +630,9 @@ namespace swift {
     ///
     /// \returns An in-flight diagnostic, to which additional information can
     /// be attached.
-    InFlightDiagnostic diagnose(SourceLoc Loc, DiagID ID, 
+    InFlightDiagnostic diagnose(SourceLoc Loc, DiagID ID,
                                 ArrayRef<DiagnosticArgument> Args) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = Diagnostic(ID, Args);
+      beginActiveDiagnostic(Diagnostic(ID, Args));
       ActiveDiagnostic->setLoc(Loc);
       return InFlightDiagnostic(*this);
     }
@@ -640,8 +665,7 @@ namespace swift {
     /// \returns An in-flight diagnostic, to which additional information can
     /// be attached.
     InFlightDiagnostic diagnose(SourceLoc Loc, const Diagnostic &D) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = D;
+      beginActiveDiagnostic(Diagnostic(D));
       ActiveDiagnostic->setLoc(Loc);
       return InFlightDiagnostic(*this);
     }
@@ -659,8 +683,7 @@ namespace swift {
     InFlightDiagnostic 
     diagnose(SourceLoc Loc, Diag<ArgTypes...> ID,
              typename detail::PassArgument<ArgTypes>::type... Args) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = Diagnostic(ID, std::move(Args)...);
+      beginActiveDiagnostic(Diagnostic(ID, std::move(Args)...));
       ActiveDiagnostic->setLoc(Loc);
       return InFlightDiagnostic(*this);
     }
@@ -678,8 +701,7 @@ namespace swift {
     InFlightDiagnostic 
     diagnose(DeclNameLoc Loc, Diag<ArgTypes...> ID,
              typename detail::PassArgument<ArgTypes>::type... Args) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = Diagnostic(ID, std::move(Args)...);
+      beginActiveDiagnostic(Diagnostic(ID, std::move(Args)...));
       ActiveDiagnostic->setLoc(Loc.getBaseNameLoc());
       return InFlightDiagnostic(*this);
     }
@@ -699,8 +721,7 @@ namespace swift {
     /// be attached.
     InFlightDiagnostic diagnose(const Decl *decl, DiagID id,
                                 ArrayRef<DiagnosticArgument> args) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = Diagnostic(id, args);
+      beginActiveDiagnostic(Diagnostic(id, args));
       ActiveDiagnostic->setDecl(decl);
       return InFlightDiagnostic(*this);
     }
@@ -716,8 +737,7 @@ namespace swift {
     /// \returns An in-flight diagnostic, to which additional information can
     /// be attached.
     InFlightDiagnostic diagnose(const Decl *decl, const Diagnostic &diag) {
-      assert(!ActiveDiagnostic && "Already have an active diagnostic");
-      ActiveDiagnostic = diag;
+      beginActiveDiagnostic(Diagnostic(diag));
       ActiveDiagnostic->setDecl(decl);
       return InFlightDiagnostic(*this);
     }
@@ -735,7 +755,7 @@ namespace swift {
     InFlightDiagnostic
     diagnose(const Decl *decl, Diag<ArgTypes...> id,
              typename detail::PassArgument<ArgTypes>::type... args) {
-      ActiveDiagnostic = Diagnostic(id, std::move(args)...);
+      beginActiveDiagnostic(Diagnostic(id, std::move(args)...));
       ActiveDiagnostic->setDecl(decl);
       return InFlightDiagnostic(*this);
     }
@@ -790,13 +810,23 @@ namespace swift {
     /// \brief Whether this transaction is currently open.
     bool IsOpen = true;
 
+    /// \brief Whether this transaction holds the parallel-emission lock.
+    bool OwnsEmissionLock = false;
+
   public:
     explicit DiagnosticTransaction(DiagnosticEngine &engine)
-      : Engine(engine),
-        PrevDiagnostics(Engine.TentativeDiagnostics.size()),
-        Depth(Engine.TransactionCount),
-        IsOpen(true)
+      : Engine(engine)
     {
+      // When diagnostics may arrive from other threads, hold the emission
+      // lock for the whole transaction: otherwise another thread's real
+      // diagnostic would be buffered into our tentative set and erased by
+      // abort(), and TransactionCount would be updated unsynchronized. The
+      // lock is recursive, so this thread's own diagnostics still flow.
+      OwnsEmissionLock = Engine.ParallelEmissionEnabled;
+      if (OwnsEmissionLock)
+        Engine.ParallelEmissionMutex.lock();
+      PrevDiagnostics = Engine.TentativeDiagnostics.size();
+      Depth = Engine.TransactionCount;
       assert(!Engine.ActiveDiagnostic);
       Engine.TransactionCount++;
     }
@@ -814,6 +844,7 @@ namespace swift {
       Engine.TentativeDiagnostics.erase(
         Engine.TentativeDiagnostics.begin() + PrevDiagnostics,
         Engine.TentativeDiagnostics.end());
+      releaseEmissionLock();
     }
 
     /// \brief Commit and close this transaction. If this is the top-level
@@ -824,6 +855,7 @@ namespace swift {
         assert(PrevDiagnostics == 0);
         Engine.emitTentativeDiagnostics();
       }
+      releaseEmissionLock();
     }
 
   private:
@@ -834,6 +866,17 @@ namespace swift {
       assert(Depth == Engine.TransactionCount &&
              "transactions must be closed LIFO");
     }
+
+    /// \brief Drop the emission lock after this transaction's effects on the
+    /// tentative set are complete.  This must come after the erase in
+    /// abort(), not in close(), or another thread could slip a diagnostic
+    /// into the range being erased.
+    void releaseEmissionLock() {
+      if (OwnsEmissionLock) {
+        OwnsEmissionLock = false;
+        Engine.ParallelEmissionMutex.unlock();
+      }
+    }
   };
 } // end namespace swift
 
@@ -145,6 +145,10 @@ public:
   /// Print the LLVM inline tree at the end of the LLVM pass pipeline.
   unsigned PrintInlineTree : 1;
 
+  /// Include a ThinLTO module summary when emitting LLVM bitcode, so that a
+  /// ThinLTO-aware linker can perform the thin-link over the outputs.
+  unsigned EmitThinLTOSummary : 1;
+
   /// Whether we should embed the bitcode file.
   IRGenEmbedMode EmbedMode : 2;
 
@@ -182,7 +186,8 @@ public:
         DisableLLVMOptzns(false), DisableLLVMARCOpts(false),
         DisableLLVMSLPVectorizer(false), DisableFPElim(true), Playground(false),
         EmitStackPromotionChecks(false), GenerateProfile(false),
-        PrintInlineTree(false), EmbedMode(IRGenEmbedMode::None),
+        PrintInlineTree(false), EmitThinLTOSummary(false),
+        EmbedMode(IRGenEmbedMode::None),
         HasValueNamesSetting(false), ValueNames(false),
         EnableReflectionMetadata(true), EnableReflectionNames(true),
         UseIncrementalLLVMCodeGen(true), UseSwiftCall(false), CmdArgs(),
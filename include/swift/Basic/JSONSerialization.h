@@ -21,6 +21,7 @@
 #define SWIFT_BASIC_JSONSERIALIZATION_H
 
 #include "swift/Basic/LLVM.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/ErrorHandling.h"
@@ -570,8 +571,12 @@ template<typename T>
 typename std::enable_if<has_ScalarTraits<T>::value,void>::type
 jsonize(Output &out, T &Val, bool) {
   {
-    std::string Storage;
-    llvm::raw_string_ostream Buffer(Storage);
+    // Render the scalar into stack scratch space rather than a heap
+    // std::string; the rendered text is needed before it hits the stream
+    // so mustQuote can inspect it. Scalars longer than the inline buffer
+    // (rare: long paths and identifiers) spill gracefully.
+    SmallString<64> Storage;
+    llvm::raw_svector_ostream Buffer(Storage);
     ScalarTraits<T>::output(Val, Buffer);
     StringRef Str = Buffer.str();
     out.scalarString(Str, ScalarTraits<T>::mustQuote(Str));
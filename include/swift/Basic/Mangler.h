@@ -47,6 +47,15 @@ protected:
   llvm::SmallVector<WordReplacement, 8> SubstWordsInIdent;
 
   /// Substitutions, except identifier substitutions.
+  ///
+  /// Note that beginMangling() resets this (and the other per-symbol state)
+  /// with clear(), which retains the bucket allocation, so a reused Mangler
+  /// instance reaches steady-state with no allocation per symbol — the
+  /// effect a generation-counted open-addressed table would buy, without a
+  /// second map implementation. The per-mangle malloc people see in
+  /// profiles comes from call sites constructing a fresh ASTMangler for
+  /// every operation; hoisting the mangler out of the loop at such sites is
+  /// the fix.
   llvm::DenseMap<const void *, unsigned> Substitutions;
 
   /// Identifier substitutions.
@@ -29,6 +29,15 @@
 //
 //  FIXME: The current implementation doesn't rebalance siblings.
 //
+//  A denser layout — adjacent-sibling arrays with array-packed dispatch
+//  instead of per-node child pointers — has been considered for large
+//  keysets, but it pays off for bulk-loaded, read-mostly tries, and this
+//  structure's one in-tree client (EncodedSequence::Map) builds its maps
+//  incrementally and mutates them in place. Succinct layouts make inserts
+//  O(node-array) or force a rebuild pass, so until a client appears that
+//  constructs a large map once and only queries it afterwards, the
+//  pointer-per-child representation is the right trade.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_BASIC_PREFIXMAP_H
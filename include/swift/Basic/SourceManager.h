@@ -14,10 +14,12 @@
 #define SWIFT_BASIC_SOURCEMANAGER_H
 
 #include "swift/Basic/SourceLoc.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
+#include <vector>
 
 namespace swift {
 
@@ -42,6 +44,14 @@ class SourceManager {
   std::map<const char *, VirtualFile> VirtualFiles;
   mutable std::pair<const char *, const VirtualFile*> CachedVFile = {nullptr, nullptr};
 
+  /// Per-buffer tables of line start offsets, built lazily on the first
+  /// line/column query for a buffer so that diagnostic-free compiles never
+  /// pay for them.  The first line always starts at offset zero.
+  mutable llvm::DenseMap<unsigned, std::vector<unsigned>> LineStartOffsets;
+
+  /// Return the line-start table for \p BufferID, building it on first use.
+  const std::vector<unsigned> &getLineStartOffsets(unsigned BufferID) const;
+
 public:
   llvm::SourceMgr &getLLVMSourceMgr() {
     return LLVMSourceMgr;
@@ -184,7 +194,7 @@ public:
     assert(Loc.isValid());
     int LineOffset = getLineOffset(Loc);
     int l, c;
-    std::tie(l, c) = LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
+    std::tie(l, c) = findLineAndColumn(Loc, BufferID);
     assert(LineOffset+l > 0 && "bogus line offset");
     return { LineOffset + l, c };
   }
@@ -196,9 +206,16 @@ public:
   /// This does not respect #line directives.
   unsigned getLineNumber(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
-    return LLVMSourceMgr.FindLineNumber(Loc.Value, BufferID);
+    return findLineAndColumn(Loc, BufferID).first;
   }
 
+  /// Returns the line and column for a source location using the lazily
+  /// built per-buffer line table.
+  ///
+  /// This does not respect #line directives.
+  std::pair<unsigned, unsigned>
+  findLineAndColumn(SourceLoc Loc, unsigned BufferID = 0) const;
+
   StringRef getEntireTextForBuffer(unsigned BufferID) const;
 
   StringRef extractText(CharSourceRange Range,
@@ -45,6 +45,19 @@
 //
 // Generally we make one of these per-process: either early in the life of the
 // driver, or early in the life of the frontend.
+//
+// The "always-on" tier below is already the cheap path: the counters are
+// plain size_t fields bumped unconditionally-compiled, unsynchronized (the
+// frontend is single-threaded) and read exactly once, at destruction, when
+// they are written out. What keeps this from being enabled fleet-wide is
+// not the counters but the constructor: creating a reporter also turns on
+// llvm::EnableStatistics (global, locked, mfenced counters all over LLVM)
+// and the compilation timers, and callers guard their increments with
+// "if (Stats)" so the counters only count when the whole apparatus is live.
+// A continuous-telemetry mode is therefore a gating change, not a new
+// counter design: construct the reporter without enabling LLVM stats or
+// timers unless explicitly asked, and the existing counters plus the JSON
+// writer are already cheap enough to leave on everywhere.
 
 namespace swift {
 
@@ -110,12 +123,14 @@ public:
     size_t NumSILGenWitnessTables;
     size_t NumSILGenDefaultWitnessTables;
     size_t NumSILGenGlobalVariables;
+    size_t NumSILGenBytesAllocated;
 
     size_t NumSILOptFunctions;
     size_t NumSILOptVtables;
     size_t NumSILOptWitnessTables;
     size_t NumSILOptDefaultWitnessTables;
     size_t NumSILOptGlobalVariables;
+    size_t NumSILOptBytesAllocated;
 
     size_t NumIRGlobals;
     size_t NumIRFunctions;
@@ -39,6 +39,19 @@ enum class TaskFinishedResponse {
 };
 
 /// \brief A class encapsulating the execution of multiple tasks in parallel.
+///
+/// addTask and execute are virtual (DummyTaskQueue overrides them for
+/// testing), so an alternate execution backend — e.g. one that ships jobs to
+/// a remote build service instead of spawning local processes — can slot in
+/// here without driver changes. The queue interface is the easy part of such
+/// a backend, though: jobs are described only as an executable path plus
+/// argument strings, and everything around them assumes a shared local
+/// filesystem. The driver writes filelists and expects outputs, .swiftdeps
+/// files, and the build record at local paths before the finished callback
+/// fires. A distributed backend therefore has to derive input/output sets
+/// from the arguments, ship inputs by content, and materialize outputs
+/// locally on completion — all below this interface, since Compilation never
+/// says which paths a job reads or writes.
 class TaskQueue {
   /// Tasks which have not begun execution.
   std::queue<std::unique_ptr<Task>> QueuedTasks;
@@ -20,6 +20,12 @@
 namespace swift {
   /// A convenience class for declaring a timer that's part of the Swift
   /// compilation timers group.
+  ///
+  /// In addition to the flat per-phase totals reported via
+  /// \c enableCompilationTimers, the begin and end of each timed region can
+  /// be recorded as events (see \c enableEventTracing) and written out in
+  /// chrome://tracing's trace event JSON format, preserving the nesting of
+  /// phases for viewing as a timeline.
   class SharedTimer {
     enum class State {
       Initial,
@@ -27,15 +33,24 @@ namespace swift {
       Enabled
     };
     static State CompilationTimersEnabled;
+    static bool EventTracingEnabled;
 
     Optional<llvm::NamedRegionTimer> Timer;
+    StringRef Name;
 
   public:
-    explicit SharedTimer(StringRef name) {
+    explicit SharedTimer(StringRef name) : Name(name) {
       if (CompilationTimersEnabled == State::Enabled)
         Timer.emplace(name, name, "swift", "Swift compilation");
       else
         CompilationTimersEnabled = State::Skipped;
+      if (EventTracingEnabled)
+        recordEvent(Name, /*isBegin=*/true);
+    }
+
+    ~SharedTimer() {
+      if (EventTracingEnabled)
+        recordEvent(Name, /*isBegin=*/false);
     }
 
     /// Must be called before any SharedTimers have been created.
@@ -44,6 +59,20 @@ namespace swift {
              "a timer has already been created");
       CompilationTimersEnabled = State::Enabled;
     }
+
+    /// Record begin/end events for every timed region, for later emission
+    /// via \c writeTraceEvents. Should be called before any SharedTimers
+    /// have been created.
+    static void enableEventTracing() {
+      EventTracingEnabled = true;
+    }
+
+    /// Write all events recorded so far to \p OS in chrome://tracing's
+    /// trace event JSON format.
+    static void writeTraceEvents(llvm::raw_ostream &OS);
+
+  private:
+    static void recordEvent(StringRef name, bool isBegin);
   };
 } // end namespace swift
 
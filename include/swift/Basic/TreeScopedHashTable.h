@@ -29,9 +29,29 @@ class TreeScopedHashTable;
 template <typename K, typename V, typename AllocatorTy = llvm::MallocAllocator>
 class TreeScopedHashTableScope;
 
-template <typename K, typename V> class TreeScopedHashTableVal {
+template <typename K, typename V, typename AllocatorTy = llvm::MallocAllocator>
+class TreeScopedHashTableScopeImpl;
+
+template <typename K, typename V, typename AllocatorTy = llvm::MallocAllocator>
+class TreeScopedHashTableIterator;
+
+template <typename K, typename V, typename AllocatorTy = llvm::MallocAllocator>
+class TreeScopedHashTableVal {
+  friend class TreeScopedHashTable<K, V, AllocatorTy>;
+  friend class TreeScopedHashTableScopeImpl<K, V, AllocatorTy>;
+  friend class TreeScopedHashTableIterator<K, V, AllocatorTy>;
+
+  typedef TreeScopedHashTableScopeImpl<K, V, AllocatorTy> ImplTy;
+
   TreeScopedHashTableVal *NextInScope;
+
+  /// The next entry in this key's flat chain; entries are linked in insertion
+  /// order, most recently inserted first.
   TreeScopedHashTableVal *NextForKey;
+
+  /// The scope that owns this entry.
+  ImplTy *Scope;
+
   K Key;
   V Val;
   TreeScopedHashTableVal(const K &Key, const V &Val) : Key(Key), Val(Val) {}
@@ -45,21 +65,21 @@ public:
   const TreeScopedHashTableVal *getNextForKey() const { return NextForKey; }
   TreeScopedHashTableVal *getNextInScope() { return NextInScope; }
 
-  template <typename AllocatorTy>
   static TreeScopedHashTableVal *Create(TreeScopedHashTableVal *NextInScope,
                                         TreeScopedHashTableVal *NextForKey,
-                                        const K &key, const V &val,
-                                        AllocatorTy &Allocator) {
+                                        ImplTy *Scope, const K &key,
+                                        const V &val, AllocatorTy &Allocator) {
     TreeScopedHashTableVal *New =
         Allocator.template Allocate<TreeScopedHashTableVal>();
     // Set up the value.
     new (New) TreeScopedHashTableVal(key, val);
     New->NextInScope = NextInScope;
     New->NextForKey = NextForKey;
+    New->Scope = Scope;
     return New;
   }
 
-  template <typename AllocatorTy> void Destroy(AllocatorTy &Allocator) {
+  void Destroy(AllocatorTy &Allocator) {
     // Free memory referenced by the item.
     this->~TreeScopedHashTableVal();
     Allocator.Deallocate(this);
@@ -68,7 +88,7 @@ public:
 
 /// \brief A reference-counted scope that actually owns the data in the
 /// hashtable.
-template <typename K, typename V, typename AllocatorTy = llvm::MallocAllocator>
+template <typename K, typename V, typename AllocatorTy>
 class TreeScopedHashTableScopeImpl {
 public:
   typedef TreeScopedHashTable<K, V, AllocatorTy> HTTy;
@@ -76,14 +96,16 @@ public:
   /// The hashtable that we are active for.
   HTTy *HT;
 
-  const typename HTTy::ScopeIDTy ID;
-
   /// This is the scope that we are shadowing in HT.
   TreeScopedHashTableScopeImpl *ParentScope;
 
+  /// Distance from the root scope; used together with \c ParentScope to
+  /// decide in constant time per step whether another scope encloses this one.
+  unsigned Depth;
+
   /// This is the last value that was inserted for this scope or null if none
   /// have been inserted yet.
-  TreeScopedHashTableVal<K, V> *LastValInScope;
+  TreeScopedHashTableVal<K, V, AllocatorTy> *LastValInScope;
 
   bool MovedFrom;
   bool OwnsParentScope;
@@ -94,22 +116,35 @@ public:
   void operator=(TreeScopedHashTableScopeImpl &) = delete;
 
   TreeScopedHashTableScopeImpl()
-      : HT(0), ID(0), ParentScope(0), MovedFrom(true), RefCount(0) {}
+      : HT(0), ParentScope(0), Depth(0), MovedFrom(true), RefCount(0) {}
 
   TreeScopedHashTableScopeImpl(TreeScopedHashTable<K, V, AllocatorTy> *HT,
                                TreeScopedHashTableScopeImpl *ParentScope)
-      : HT(HT), ID(HT->getNextScopeID()), ParentScope(ParentScope),
-        LastValInScope(0), MovedFrom(false), OwnsParentScope(false),
-        RefCount(0) {}
+      : HT(HT), ParentScope(ParentScope),
+        Depth(ParentScope ? ParentScope->Depth + 1 : 0), LastValInScope(0),
+        MovedFrom(false), OwnsParentScope(false), RefCount(0) {}
 
   TreeScopedHashTableScopeImpl(TreeScopedHashTableScopeImpl &&Other)
-    : HT(Other.HT), ID(Other.ID), ParentScope(Other.ParentScope),
+    : HT(Other.HT), ParentScope(Other.ParentScope), Depth(Other.Depth),
       LastValInScope(Other.LastValInScope), MovedFrom(false),
       OwnsParentScope(Other.OwnsParentScope), RefCount(Other.RefCount) {
     assert(!Other.MovedFrom && "moving from a moved-from scope");
     Other.MovedFrom = true;
-    // *Don't* set Other.ID to a trap value so that the old scope object can
-    // be still used for lookup.
+    // Repoint the entries at the new scope object.  The old scope object can
+    // be still used for lookup because visibility is decided by walking the
+    // parent chain, which the old object remains part of.
+    for (TreeScopedHashTableVal<K, V, AllocatorTy> *I = LastValInScope; I;
+         I = I->getNextInScope())
+      I->Scope = this;
+  }
+
+  /// Returns true if an entry owned by this scope is visible from \p Leaf,
+  /// i.e. if this scope is \p Leaf or one of its ancestors.  The walk is
+  /// bounded by the depth difference, not by the total nesting depth.
+  bool isVisibleFrom(const TreeScopedHashTableScopeImpl *Leaf) const {
+    while (Leaf && Leaf->Depth > Depth)
+      Leaf = Leaf->ParentScope;
+    return Leaf == this;
   }
 
   void retain() {
@@ -225,12 +260,28 @@ public:
   }
 };
 
-template <typename K, typename V> class TreeScopedHashTableIterator {
-  TreeScopedHashTableVal<K, V> *Node;
+/// \brief Iterates over the entries for one key that are visible from a given
+/// scope, innermost first.
+template <typename K, typename V, typename AllocatorTy>
+class TreeScopedHashTableIterator {
+  typedef TreeScopedHashTableScopeImpl<K, V, AllocatorTy> ImplTy;
+
+  TreeScopedHashTableVal<K, V, AllocatorTy> *Node;
+  const ImplTy *LookupScope;
+
+  /// Advance \p N along the key chain to the next entry that is visible from
+  /// the lookup scope.
+  TreeScopedHashTableVal<K, V, AllocatorTy> *
+  skipHidden(TreeScopedHashTableVal<K, V, AllocatorTy> *N) const {
+    while (N && !N->Scope->isVisibleFrom(LookupScope))
+      N = N->getNextForKey();
+    return N;
+  }
 
 public:
-  TreeScopedHashTableIterator(TreeScopedHashTableVal<K, V> *Node)
-      : Node(Node) {}
+  TreeScopedHashTableIterator(TreeScopedHashTableVal<K, V, AllocatorTy> *Node,
+                              const ImplTy *LookupScope)
+      : Node(Node), LookupScope(LookupScope) {}
 
   V &operator*() const {
     assert(Node && "Dereference end()");
@@ -247,7 +298,7 @@ public:
 
   inline TreeScopedHashTableIterator &operator++() { // Preincrement
     assert(Node && "incrementing past end()");
-    Node = Node->getNextForKey();
+    Node = skipHidden(Node->getNextForKey());
     return *this;
   }
   TreeScopedHashTableIterator operator++(int) { // Postincrement
@@ -273,6 +324,12 @@ public:
 /// hashtable.
 ///
 /// All scopes should be destroyed before hashtable is destroyed.
+///
+/// The table keeps one flat chain of entries per key, tagged with the owning
+/// scope, instead of keying the map by (key, scope).  A lookup is a single
+/// hash probe followed by a scan of that key's chain for the deepest entry
+/// whose scope encloses the lookup scope, so the cost does not grow with the
+/// nesting depth; a miss is exactly one probe.
 template <typename K, typename V, typename AllocatorTy>
 class TreeScopedHashTable {
 public:
@@ -282,28 +339,58 @@ public:
   typedef TreeScopedHashTableDetachedScope<K, V, AllocatorTy> DetachedScopeTy;
 
 private:
-  typedef unsigned ScopeIDTy;
-  typedef std::pair<K, ScopeIDTy> KeyTy;
-  typedef TreeScopedHashTableVal<K, V> ValTy;
-  llvm::DenseMap<KeyTy, ValTy *> TopLevelMap;
-
-  AllocatorTy Allocator;
+  typedef TreeScopedHashTableScopeImpl<K, V, AllocatorTy> ImplTy;
+  typedef TreeScopedHashTableVal<K, V, AllocatorTy> ValTy;
 
-  ScopeIDTy NextScopeID;
+  /// Maps each key to the head of its chain of entries, most recently
+  /// inserted first.
+  llvm::DenseMap<K, ValTy *> KeyChains;
 
-  ScopeIDTy getNextScopeID() {
-    return NextScopeID++;
-  }
+  AllocatorTy Allocator;
 
   TreeScopedHashTable(const TreeScopedHashTable &) = delete;
   void operator=(const TreeScopedHashTable &) = delete;
   friend class TreeScopedHashTableScopeImpl<K, V, AllocatorTy>;
 
+  /// Splice \p Entry out of its key's chain.
+  void removeEntryFromChain(ValTy *Entry) {
+    typename llvm::DenseMap<K, ValTy *>::iterator I =
+        KeyChains.find(Entry->Key);
+    assert(I != KeyChains.end() && "Scope imbalance!");
+    ValTy **Link = &I->second;
+    while (*Link != Entry) {
+      assert(*Link && "entry is not in its key chain");
+      Link = &(*Link)->NextForKey;
+    }
+    *Link = Entry->NextForKey;
+    if (!I->second)
+      KeyChains.erase(I);
+  }
+
+  /// Returns the deepest entry in \p Key's chain that is visible from
+  /// \p LookupScope, or null if there is none.
+  ValTy *findVisibleEntry(const ImplTy *LookupScope, const K &Key) const {
+    typename llvm::DenseMap<K, ValTy *>::const_iterator I =
+        KeyChains.find(Key);
+    if (I == KeyChains.end())
+      return 0;
+    // A chain is usually in innermost-first order, but inserting into an
+    // outer scope while a detached descendant holds the same key can put a
+    // shallower entry in front, so scan the whole chain for the deepest
+    // visible entry.
+    ValTy *Best = 0;
+    for (ValTy *E = I->second; E; E = E->NextForKey)
+      if ((!Best || E->Scope->Depth > Best->Scope->Depth) &&
+          E->Scope->isVisibleFrom(LookupScope))
+        Best = E;
+    return Best;
+  }
+
 public:
-  TreeScopedHashTable() : NextScopeID(0) {}
-  TreeScopedHashTable(AllocatorTy A) : Allocator(A), NextScopeID(0) {}
+  TreeScopedHashTable() {}
+  TreeScopedHashTable(AllocatorTy A) : Allocator(A) {}
   ~TreeScopedHashTable() {
-    assert(TopLevelMap.empty() && "Scope imbalance!");
+    assert(KeyChains.empty() && "Scope imbalance!");
   }
 
   /// Access to the allocator.
@@ -313,39 +400,25 @@ public:
   AllocatorCRefTy getAllocator() const { return Allocator; }
 
   bool count(const ScopeTy &S, const K &Key) const {
-    const typename ScopeTy::ImplTy *CurrScope = S.getImpl();
-    while (CurrScope) {
-      if (TopLevelMap.count(std::make_pair(Key, CurrScope->ID))) {
-        return true;
-      }
-      CurrScope = CurrScope->ParentScope;
-    }
-    return false;
+    return findVisibleEntry(S.getImpl(), Key) != 0;
   }
 
 public:
   V lookup(const ScopeTy &S, const K &Key) {
-    const typename ScopeTy::ImplTy *CurrScope = S.getImpl();
-    while (CurrScope) {
-      typename llvm::DenseMap<KeyTy, ValTy *>::iterator I =
-          TopLevelMap.find(std::make_pair(Key, CurrScope->ID));
-      if (I != TopLevelMap.end())
-        return I->second->getValue();
-      CurrScope = CurrScope->ParentScope;
-    }
+    if (ValTy *E = findVisibleEntry(S.getImpl(), Key))
+      return E->getValue();
     return V();
   }
 
-  typedef TreeScopedHashTableIterator<K, V> iterator;
+  typedef TreeScopedHashTableIterator<K, V, AllocatorTy> iterator;
 
-  iterator end() { return iterator(0); }
+  iterator end() { return iterator(0, 0); }
 
   iterator begin(ScopeTy &S, const K &Key) {
-    typename llvm::DenseMap<KeyTy, ValTy *>::iterator I =
-        TopLevelMap.find(std::make_pair(Key, S.getImpl()->ID));
-    if (I == TopLevelMap.end())
+    ValTy *E = findVisibleEntry(S.getImpl(), Key);
+    if (!E)
       return end();
-    return iterator(I->second);
+    return iterator(E, S.getImpl());
   }
 
   /// This inserts the specified key/value at the specified
@@ -353,39 +426,28 @@ public:
   /// that isn't the current one, it isn't ok to insert *underneath* an existing
   /// value of the specified key.
   void insertIntoScope(ScopeTy &S, const K &Key, const V &Val) {
-    TreeScopedHashTableVal<K, V> *PrevEntry = 0;
-    const typename ScopeTy::ImplTy *CurrScope = S.getImpl();
-    while (CurrScope) {
-      typename llvm::DenseMap<KeyTy, ValTy *>::iterator I =
-          TopLevelMap.find(std::make_pair(Key, CurrScope->ID));
-      if (I != TopLevelMap.end()) {
-        PrevEntry = I->second;
-        break;
-      }
-      CurrScope = CurrScope->ParentScope;
-    }
-    assert(TopLevelMap.find(std::make_pair(Key, S.getImpl()->ID)) == TopLevelMap.end());
-
-    TreeScopedHashTableVal<K, V> *&KeyEntry =
-        TopLevelMap[std::make_pair(Key, S.getImpl()->ID)];
-    KeyEntry =
-        ValTy::Create(S.getImpl()->LastValInScope, PrevEntry, Key, Val, Allocator);
-    S.getImpl()->LastValInScope = KeyEntry;
+    ImplTy *Impl = S.getImpl();
+    ValTy *&Head = KeyChains[Key];
+#ifndef NDEBUG
+    for (ValTy *E = Head; E; E = E->NextForKey)
+      assert(E->Scope != Impl && "duplicate key in scope");
+#endif
+    Head = ValTy::Create(Impl->LastValInScope, Head, Impl, Key, Val, Allocator);
+    Impl->LastValInScope = Head;
   }
 };
 
-template <typename K, typename V, typename Allocator>
-TreeScopedHashTableScopeImpl<K, V, Allocator>::~TreeScopedHashTableScopeImpl() {
+template <typename K, typename V, typename AllocatorTy>
+TreeScopedHashTableScopeImpl<K, V, AllocatorTy>::
+    ~TreeScopedHashTableScopeImpl() {
   if (MovedFrom)
     return;
 
   // Pop and delete all values corresponding to this scope.
-  while (TreeScopedHashTableVal<K, V> *ThisEntry = LastValInScope) {
-    // Pop this value out of the TopLevelMap.
-    assert(HT->TopLevelMap[std::make_pair(ThisEntry->getKey(), this->ID)] ==
-               ThisEntry &&
-           "Scope imbalance!");
-    HT->TopLevelMap.erase(std::make_pair(ThisEntry->getKey(), this->ID));
+  while (TreeScopedHashTableVal<K, V, AllocatorTy> *ThisEntry =
+             LastValInScope) {
+    // Splice this value out of its key chain.
+    HT->removeEntryFromChain(ThisEntry);
 
     // Pop this value out of the scope.
     LastValInScope = ThisEntry->getNextInScope();
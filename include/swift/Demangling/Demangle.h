@@ -445,6 +445,19 @@ std::string nodeToString(NodePointer Root,
                          const DemangleOptions &Options = DemangleOptions());
 
 /// A class for printing to a std::string.
+/// Accumulates demangled output in a single growing string.
+///
+/// The growth is amortized, not per-append: printing reallocates
+/// O(log(output size)) times per symbol, so "allocator traffic" here is a
+/// handful of geometric reallocations, not one per node. A caller-provided
+/// fixed buffer with a resume-on-overflow protocol has been considered for
+/// zero-allocation symbolizers; resumability is the expensive part, since
+/// NodePrinter would have to checkpoint a recursive tree walk mid-print,
+/// and the public entry points return std::string by value anyway. A
+/// simpler route to the same end: demangled sizes are modest and
+/// predictable, so a printer whose Stream was reserve()d to the caller's
+/// high-water mark reaches steady-state zero allocation without any
+/// protocol change.
 class DemanglerPrinter {
 public:
   DemanglerPrinter() = default;
@@ -207,6 +207,18 @@ public:
 ///
 /// The graph also supports a "mark" operation, which is intended to track
 /// nodes that have been not just visited but transitively marked through.
+///
+/// Granularity note: nodes are files and edge labels are names, so a change
+/// to one member of a popular type dirties every file referencing that
+/// type's name. The existing defenses are the cascading bit (non-cascading
+/// edges stop transitive rebuilds) and the per-file interface hash, which
+/// lets a body-only edit leave downstream jobs unscheduled. Refining this
+/// to (decl, interface-vs-body) nodes is primarily a frontend problem, not
+/// a driver one: this graph only replays what the swiftdeps files record,
+/// and those are produced from Sema's referenced-name tracking, which
+/// neither attributes references to individual members nor hashes decl
+/// interfaces separately. Until the frontend emits that, finer nodes here
+/// would be labels with nothing to connect them.
 template <typename T>
 class DependencyGraph : public DependencyGraphImpl {
   using Traits = llvm::PointerLikeTypeTraits<T>;
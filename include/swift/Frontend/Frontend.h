@@ -38,6 +38,7 @@
 #include "swift/Serialization/Validation.h"
 #include "swift/SIL/SILModule.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/Option/ArgList.h"
 #include "llvm/Support/Host.h"
 #include "llvm/Support/MemoryBuffer.h"
@@ -314,6 +315,16 @@ public:
 /// calling \a setup.  If successful, this will create an ASTContext
 /// and set up the basic compiler invariants.  Calling \a setup multiple
 /// times on a single CompilerInstance is not permitted.
+///
+/// That single-setup contract is also why an instance cannot serve as the
+/// core of a long-lived compile server. The ASTContext accretes state
+/// monotonically — imported modules, uniqued types, synthesized decls — and
+/// nothing supports evicting the parts derived from a file that changed, so
+/// "retain hot state, invalidate on edit" degenerates into rebuilding the
+/// context, which is the cold start again. Reuse across requests is only
+/// sound at the granularity of whole contexts over immutable inputs (this
+/// is how SourceKit uses these classes, one instance per open document,
+/// discarded on invalidation).
 class CompilerInstance {
   CompilerInvocation Invocation;
   SourceManager SourceMgr;
@@ -341,12 +352,33 @@ class CompilerInstance {
 
   enum : unsigned { NO_SUCH_BUFFER = ~0U };
   unsigned MainBufferID = NO_SUCH_BUFFER;
-  unsigned PrimaryBufferID = NO_SUCH_BUFFER;
 
-  SourceFile *PrimarySourceFile = nullptr;
+  /// The buffer IDs of the primary inputs.  Empty for a whole-module
+  /// compilation.  Kept in the order the inputs were recorded so the
+  /// outputs of a multi-primary compilation line up with its inputs.
+  llvm::SetVector<unsigned> PrimaryBufferIDs;
+
+  /// The SourceFiles created for the primary inputs, in the same order as
+  /// \c PrimaryBufferIDs.
+  std::vector<SourceFile *> PrimarySourceFiles;
 
   void createSILModule(bool WholeModule = false);
-  void setPrimarySourceFile(SourceFile *SF);
+
+  /// Record the buffer with the given ID as a primary input, so that the
+  /// SourceFile created for it will be type-checked.
+  void recordPrimaryInputBuffer(unsigned BufID);
+
+  /// Record the given SourceFile as a primary input.
+  void recordPrimarySourceFile(SourceFile *SF);
+
+  /// True unless at least one primary input was recorded, in which case
+  /// only the primary files are fully type-checked.
+  bool isWholeModuleCompilation() const { return PrimaryBufferIDs.empty(); }
+
+  /// Whether the buffer with the given ID is one of the primary inputs.
+  bool isPrimaryInput(unsigned BufID) const {
+    return PrimaryBufferIDs.count(BufID);
+  }
 
 public:
   SourceManager &getSourceMgr() { return SourceMgr; }
@@ -374,7 +406,8 @@ public:
   }
 
   void setReferencedNameTracker(ReferencedNameTracker *tracker) {
-    assert(!PrimarySourceFile && "must be called before performSema()");
+    assert(PrimarySourceFiles.empty() &&
+           "must be called before performSema()");
     NameTracker = tracker;
   }
   ReferencedNameTracker *getReferencedNameTracker() {
@@ -414,9 +447,21 @@ public:
     return Invocation.getFrontendOptions().EnableSourceImport;
   }
 
+  /// Gets the SourceFiles which are the primary inputs for this
+  /// CompilerInstance, in the order the inputs were recorded.  Empty for a
+  /// whole-module compilation.
+  ArrayRef<SourceFile *> getPrimarySourceFiles() { return PrimarySourceFiles; }
+
   /// Gets the SourceFile which is the primary input for this CompilerInstance.
-  /// \returns the primary SourceFile, or nullptr if there is no primary input
-  SourceFile *getPrimarySourceFile() { return PrimarySourceFile; }
+  /// \returns the primary SourceFile, or nullptr if there is no primary input;
+  /// aborts if there is more than one.
+  SourceFile *getPrimarySourceFile() {
+    if (PrimarySourceFiles.empty())
+      return nullptr;
+    assert(PrimarySourceFiles.size() == 1 &&
+           "have multiple primaries; caller should use getPrimarySourceFiles");
+    return PrimarySourceFiles.front();
+  }
 
   /// \brief Returns true if there was an error during setup.
   bool setup(const CompilerInvocation &Invocation);
@@ -158,6 +158,11 @@ public:
   /// too complex.
   unsigned SolverExpressionTimeThreshold = 0;
 
+  /// If non-zero, the number of milliseconds the expression type checker
+  /// may spend exploring an expression's solution space before settling
+  /// for the best solution found so far ("anytime" mode).
+  unsigned SolverAnytimeBudget = 0;
+
   enum ActionType {
     NoneAction, ///< No specific action
     Parse, ///< Parse only
@@ -217,6 +222,13 @@ public:
   /// \sa swift::SharedTimer
   bool DebugTimeCompilation = false;
 
+  /// If non-empty, the path to which begin/end events for each major
+  /// compilation phase are written in chrome://tracing's trace event JSON
+  /// format.
+  ///
+  /// \sa swift::SharedTimer
+  std::string TraceTimeCompilationPath;
+
   /// The path to which we should output statistics files.
   std::string StatsOutputDir;
 
@@ -224,6 +236,17 @@ public:
   /// until the end of all files.
   bool DelayedFunctionBodyParsing = false;
 
+  /// Indicates whether the parse phase should run on multiple threads, one
+  /// SourceFile per worker.  The worker threads rendezvous in the ASTContext
+  /// for identifier uniquing and diagnostic emission.
+  bool ParallelParsing = false;
+
+  /// Indicates whether function bodies in non-primary files should be
+  /// recorded as token ranges and only parsed on demand.  Sema never
+  /// type-checks those bodies, so in a -primary-file compile only the
+  /// transparent ones are ever materialized.
+  bool LazyNonPrimaryFunctionBodies = false;
+
   /// If true, serialization encodes an extra lookup table for use in module-
   /// merging when emitting partial modules (the per-file modules in a non-WMO
   /// build).
@@ -33,6 +33,10 @@
 #include "swift/Parse/ParserResult.h"
 #include "swift/Config.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/Support/Allocator.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 namespace llvm {
   template <typename PT1, typename PT2, typename PT3> class PointerUnion3;
@@ -83,6 +87,13 @@ class Parser {
   SourceLoc DelayedDeclEnd;
   std::vector<Token> SplitTokens;
 
+  /// An arena for short-lived allocations made while parsing a single
+  /// top-level declaration, such as the scratch vectors backing expression
+  /// and argument lists.  It is reset wholesale after each top-level
+  /// declaration, so nothing allocated from it may escape the parse of the
+  /// current one.
+  llvm::BumpPtrAllocator ScratchArena;
+
 public:
   SourceManager &SourceMgr;
   DiagnosticEngine &Diags;
@@ -337,6 +348,81 @@ public:
     friend class Parser;
   };
 
+  /// A growable vector whose storage is drawn from the parser's scratch
+  /// arena instead of malloc.  Intended for the short-lived lists built while
+  /// parsing expression and argument sequences; since the arena is reset
+  /// after each top-level declaration, instances must not outlive the parse
+  /// of the current one.  Elements must be trivially copyable because growing
+  /// relocates the storage with memcpy.
+  template <typename T>
+  class ScratchVector {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "scratch vectors relocate their elements with memcpy");
+
+    llvm::BumpPtrAllocator &Arena;
+    T *Data = nullptr;
+    size_t Count = 0;
+    size_t Capacity = 0;
+
+    void grow(size_t MinCapacity) {
+      size_t NewCapacity = std::max(std::max(2 * Capacity, MinCapacity),
+                                    size_t(8));
+      T *NewData = Arena.Allocate<T>(NewCapacity);
+      if (Count)
+        memcpy(NewData, Data, Count * sizeof(T));
+      Data = NewData;
+      Capacity = NewCapacity;
+    }
+
+  public:
+    explicit ScratchVector(Parser &P) : Arena(P.ScratchArena) {}
+
+    size_t size() const { return Count; }
+    bool empty() const { return Count == 0; }
+
+    T *begin() { return Data; }
+    T *end() { return Data + Count; }
+    const T *begin() const { return Data; }
+    const T *end() const { return Data + Count; }
+
+    T &operator[](size_t Index) {
+      assert(Index < Count && "index out of bounds");
+      return Data[Index];
+    }
+    const T &operator[](size_t Index) const {
+      assert(Index < Count && "index out of bounds");
+      return Data[Index];
+    }
+
+    T &back() {
+      assert(Count && "vector is empty");
+      return Data[Count - 1];
+    }
+
+    void push_back(const T &Elt) {
+      if (Count == Capacity)
+        grow(Count + 1);
+      Data[Count++] = Elt;
+    }
+
+    void pop_back() {
+      assert(Count && "vector is empty");
+      --Count;
+    }
+
+    /// Grow (value-initializing new elements) or shrink to \p N elements.
+    void resize(size_t N) {
+      if (N > Capacity)
+        grow(N);
+      for (size_t Index = Count; Index < N; ++Index)
+        Data[Index] = T();
+      Count = N;
+    }
+
+    operator ArrayRef<T>() const { return ArrayRef<T>(Data, Count); }
+    operator MutableArrayRef<T>() { return MutableArrayRef<T>(Data, Count); }
+  };
+
   ParserPosition getParserPosition() {
     return ParserPosition(L->getStateForBeginningOfToken(Tok),
                           PreviousLoc);
@@ -1227,13 +1313,17 @@ public:
   ParserResult<Expr> parseExprList(tok LeftTok, tok RightTok);
 
   /// Parse an expression list, keeping all of the pieces separated.
+  ///
+  /// The output vectors draw their storage from the parser's scratch arena,
+  /// so the caller is expected to copy anything it keeps into AST-owned
+  /// memory before the current top-level declaration finishes parsing.
   ParserStatus parseExprList(tok leftTok, tok rightTok,
                              bool isPostfix,
                              bool isExprBasic,
                              SourceLoc &leftLoc,
-                             SmallVectorImpl<Expr *> &exprs,
-                             SmallVectorImpl<Identifier> &exprLabels,
-                             SmallVectorImpl<SourceLoc> &exprLabelLocs,
+                             ScratchVector<Expr *> &exprs,
+                             ScratchVector<Identifier> &exprLabels,
+                             ScratchVector<SourceLoc> &exprLabelLocs,
                              SourceLoc &rightLoc,
                              Expr *&trailingClosure);
 
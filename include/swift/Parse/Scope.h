@@ -34,8 +34,11 @@ class ScopeInfo {
   friend class Scope;
 public:
   typedef std::pair<unsigned, ValueDecl*> ValueScopeEntry;
-  
-  typedef TreeScopedHashTable<DeclName, ValueScopeEntry> ScopedHTTy;
+
+  /// Scope entries are pooled in a bump allocator that lives as long as the
+  /// parser state, so pushing and popping scopes does not hit malloc.
+  typedef TreeScopedHashTable<DeclName, ValueScopeEntry,
+                              llvm::BumpPtrAllocator> ScopedHTTy;
   typedef ScopedHTTy::ScopeTy ScopedHTScopeTy;
   typedef ScopedHTTy::DetachedScopeTy ScopedHTDetachedScopeTy;
 
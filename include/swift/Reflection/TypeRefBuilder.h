@@ -120,6 +120,17 @@ struct FieldTypeInfo {
 ///
 /// Note that the TypeRefBuilder owns the memory for all TypeRefs
 /// it vends.
+///
+/// TypeRef nodes are already interned: each kind keeps a TypeRefID-profiled
+/// map (the Id##TypeRefs members below), so structurally equal trees share
+/// one node and pointer equality works. What is *not* cached is the decode
+/// step itself — every examined object re-demangles its mangled type string
+/// and re-walks the node tree before landing on the interned result, which
+/// is where time goes when millions of objects repeat a few hundred types.
+/// A memoization keyed by the mangled string (or by its image-relative
+/// address for remote readers) in front of the demangle would close that;
+/// it belongs at the mangled-name entry points, which live in the shared
+/// MetadataReader rather than in this class.
 class TypeRefBuilder {
 #define TYPEREF(Id, Parent) friend class Id##TypeRef;
 #include "swift/Reflection/TypeRefs.def"
@@ -0,0 +1,133 @@
+//===--- CachingMemoryReader.h - Cached remote memory access ----*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares a MemoryReader decorator that caches reads at page
+//  granularity, so that the pointer-chasing access patterns of
+//  MetadataReader turn into one underlying read per touched page instead of
+//  one per field.
+//
+//  The cache never invalidates, so this is only suitable when the remote
+//  address space cannot change underneath it: core files, stopped processes,
+//  and one-shot inspection passes. Clients inspecting a running process
+//  should discard the reader (or not use this wrapper) across resumes.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_CACHINGMEMORYREADER_H
+#define SWIFT_REMOTE_CACHINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace swift {
+namespace remote {
+
+/// A MemoryReader that forwards to another reader, caching successful
+/// reads in page-sized chunks.
+class CachingMemoryReader final : public MemoryReader {
+  std::shared_ptr<MemoryReader> Underlying;
+
+  /// The size of a cached chunk. This does not need to match the remote
+  /// page size; it just bounds the amount of over-read per miss.
+  static const uint64_t PageSize = 4096;
+
+  /// Cached pages, keyed by page-aligned remote address. An entry with an
+  /// empty vector records a page that failed to read, so repeated probes
+  /// of unmapped ranges don't retry the underlying reader.
+  std::unordered_map<uint64_t, std::vector<uint8_t>> Pages;
+
+  const std::vector<uint8_t> &getPage(uint64_t pageAddress) {
+    auto cached = Pages.find(pageAddress);
+    if (cached != Pages.end())
+      return cached->second;
+
+    std::vector<uint8_t> page(PageSize);
+    if (!Underlying->readBytes(RemoteAddress(pageAddress), page.data(),
+                               PageSize)) {
+      // Whole-page reads can fail when the range straddles the end of a
+      // mapping even though the requested bytes are readable; record
+      // nothing and let readBytes fall back to a direct read.
+      page.clear();
+    }
+    return Pages.emplace(pageAddress, std::move(page)).first->second;
+  }
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> underlying)
+      : Underlying(std::move(underlying)) {}
+
+  uint8_t getPointerSize() override { return Underlying->getPointerSize(); }
+
+  uint8_t getSizeSize() override { return Underlying->getSizeSize(); }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Underlying->getSymbolAddress(name);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    uint64_t cursor = address.getAddressData();
+    uint64_t remaining = size;
+    while (remaining > 0) {
+      uint64_t pageAddress = cursor & ~(PageSize - 1);
+      uint64_t offset = cursor - pageAddress;
+      uint64_t chunk = std::min(remaining, PageSize - offset);
+
+      const auto &page = getPage(pageAddress);
+      if (page.empty()) {
+        // The containing page wasn't fully readable. Try the exact request
+        // against the underlying reader rather than failing outright.
+        return Underlying->readBytes(RemoteAddress(cursor), dest, remaining);
+      }
+
+      memcpy(dest, page.data() + offset, chunk);
+      dest += chunk;
+      cursor += chunk;
+      remaining -= chunk;
+    }
+    return true;
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    // Strings rarely cross many pages; read through the page cache a byte
+    // run at a time.
+    uint64_t cursor = address.getAddressData();
+    dest.clear();
+    while (true) {
+      uint64_t pageAddress = cursor & ~(PageSize - 1);
+      const auto &page = getPage(pageAddress);
+      if (page.empty()) {
+        dest.clear();
+        return Underlying->readString(address, dest);
+      }
+
+      for (uint64_t offset = cursor - pageAddress; offset < PageSize;
+           ++offset) {
+        uint8_t c = page[offset];
+        if (c == 0)
+          return true;
+        dest.push_back(c);
+        ++cursor;
+      }
+    }
+  }
+};
+
+} // end namespace remote
+} // end namespace swift
+
+#endif // SWIFT_REMOTE_CACHINGMEMORYREADER_H
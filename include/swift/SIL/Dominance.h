@@ -32,6 +32,21 @@ using PostDominatorTreeBase = llvm::DominatorTreeBase<swift::SILBasicBlock, true
 using DominanceInfoNode = llvm::DomTreeNodeBase<SILBasicBlock>;
 
 /// A class for computing basic dominance information.
+///
+/// The base class provides incremental maintenance in two forms, and both are
+/// instantiated for SIL in Dominance.cpp:
+///
+/// - exact O(1) surgery (addNewBlock, changeImmediateDominator, eraseNode)
+///   for rewrites whose effect on the tree is known, used by the utilities in
+///   SILOptimizer/Utils/CFG.cpp such as splitEdge;
+/// - generic edge updates (insertEdge, deleteEdge) for single CFG edge
+///   changes whose tree effect is not obvious at the rewrite site.
+///
+/// Passes should prefer these over recalculate() for local rewrites. The
+/// full recalculations that remain in SimplifyCFG follow cloning-based jump
+/// threading, where the set of changed edges spans block clones and critical
+/// edge splits that do not report what they changed; rebuilding there is
+/// cheaper and safer than replaying the edits one update at a time.
 class DominanceInfo : public DominatorTreeBase {
   using super = DominatorTreeBase;
 public:
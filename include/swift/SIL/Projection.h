@@ -368,6 +368,11 @@ public:
   /// Convenience method for getting the raw underlying kind.
   ProjectionKind getKind() const { return *Value.getKind(); }
 
+  /// Returns the raw pointer-sized encoding of this projection. Two
+  /// projections are equal exactly when their encodings are equal, so this is
+  /// what hashing should consume.
+  uintptr_t getRawEncoding() const { return Value.getStorage(); }
+
   /// Returns true if this instruction projects from an address type to an
   /// address subtype.
   static bool isAddressProjection(SILValue V) {
@@ -689,9 +694,14 @@ static inline llvm::hash_code hash_value(const ProjectionPath &P) {
   return llvm::hash_combine_range(P.begin(), P.end());
 }
 
-/// Returns the hashcode for the projection path.
+/// Returns the hashcode for the projection.
+///
+/// Hash the full encoding, not just the kind: in struct-heavy code nearly
+/// every projection on a path is a struct field projection, and a kind-only
+/// hash collapses all of them into one bucket chain in the load/store
+/// optimizers' location tables.
 static inline llvm::hash_code hash_value(const Projection &P) {
-  return llvm::hash_combine(static_cast<unsigned>(P.getKind()));
+  return llvm::hash_value(P.getRawEncoding());
 }
 
 class ProjectionTree;
@@ -117,6 +117,14 @@ private:
   class SerializationCallback;
 
   /// Allocator that manages the memory of all the pieces of the SILModule.
+  ///
+  /// The allocator, the function table, and the lists below are deliberately
+  /// unsynchronized: a SILModule is only ever mutated from one thread.
+  /// Emitting functions concurrently would also require locking the
+  /// TypeConverter's lowering caches and the ASTContext's type uniquing, and
+  /// SILGen's emission order is observable (e.g. in the ordering of
+  /// diagnostics and of functions in the output), so any parallel-SILGen
+  /// effort has to start above this level, not with the containers here.
   mutable llvm::BumpPtrAllocator BPA;
 
   /// The swift Module associated with this SILModule.
@@ -583,7 +591,12 @@ public:
 
   /// \brief Run the SIL verifier to make sure that all Functions follow
   /// invariants.
-  void verify() const;
+  ///
+  /// If \p verifyFunctions is false, function bodies are not verified; only
+  /// the module-level structure is checked: symbol-name uniqueness, globals,
+  /// vtables and the vtable entry cache, and witness tables. This is used to
+  /// scope verification to functions a pass actually changed.
+  void verify(bool verifyFunctions = true) const;
 
   /// Pretty-print the module.
   void dump(bool Verbose = false) const;
@@ -623,6 +636,12 @@ public:
   /// Allocate memory using the module's internal allocator.
   void *allocate(unsigned Size, unsigned Align) const;
 
+  /// Returns the number of bytes claimed from the module's internal
+  /// allocator, for memory accounting.
+  size_t getBytesAllocated() const {
+    return BPA.getBytesAllocated();
+  }
+
   template <typename T> T *allocate(unsigned Count) const {
     return static_cast<T *>(allocate(sizeof(T) * Count, alignof(T)));
   }
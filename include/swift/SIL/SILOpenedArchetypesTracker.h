@@ -31,7 +31,10 @@ namespace swift {
 /// The intended clients of this class are SILGen, SIL deserializers, etc.
 class SILOpenedArchetypesTracker : public DeleteNotificationHandler {
 public:
-  typedef llvm::DenseMap<ArchetypeType *, SILValue> OpenedArchetypeDefsMap;
+  /// Functions typically open only a handful of existentials, so keep the
+  /// first few entries inline and avoid a heap allocation per tracker.
+  typedef llvm::SmallDenseMap<ArchetypeType *, SILValue, 8>
+      OpenedArchetypeDefsMap;
 
   SILOpenedArchetypesTracker(SILOpenedArchetypesTracker &Tracker)
       : SILOpenedArchetypesTracker(Tracker.F, Tracker) {}
@@ -16,6 +16,7 @@
 #include "swift/SIL/SILDebugScope.h"
 #include "swift/SIL/SILValue.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/raw_ostream.h"
 
 namespace swift {
@@ -24,6 +25,7 @@ class SILDebugScope;
 class SILInstruction;
 class SILFunction;
 class SILBasicBlock;
+struct PrintOptions;
 
 /// Used as context for the SIL print functions.
 class SILPrintContext {
@@ -63,6 +65,14 @@ protected:
 
   llvm::DenseMap<const SILDebugScope *, unsigned> ScopeToIDMap;
 
+  /// Textual representations of already-printed types, keyed by the type
+  /// pointer. Large dumps print the same handful of types over and over;
+  /// the texts live in the allocator below for the lifetime of the context.
+  llvm::DenseMap<const void *, StringRef> TypeTextCache;
+
+  /// Storage for the cached type texts.
+  llvm::BumpPtrAllocator TypeTextAllocator;
+
   /// Dump more information in the SIL output.
   bool Verbose;
   
@@ -105,6 +115,11 @@ public:
 
   SILPrintContext::ID getID(SILValue V);
 
+  /// Returns the textual representation of \p Ty under \p Options, printing
+  /// it and caching the result the first time the type is seen. The caller
+  /// must use the same options for every query on this context.
+  StringRef getTypeText(CanType Ty, const PrintOptions &Options);
+
   /// Returns true if the \p Scope has and ID assigned.
   bool hasScopeID(const SILDebugScope *Scope) const {
     return ScopeToIDMap.count(Scope) != 0;
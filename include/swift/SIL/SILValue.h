@@ -134,6 +134,17 @@ llvm::raw_ostream &operator<<(llvm::raw_ostream &os, ValueOwnershipKind Kind);
 /// runtime computed value. Things like SILInstruction derive from this.
 class alignas(8) ValueBase : public SILAllocated<ValueBase> {
   SILType Type;
+  /// Head of this value's use list.
+  ///
+  /// Note on layout: operands live inside their owning instruction's
+  /// allocation (see FixedOperandList and TailAllocatedOperandList), so a
+  /// use-list walk has the locality of the instructions themselves; the
+  /// operands of a function cannot be segregated into their own slab
+  /// without splitting them out of the instruction objects. Likewise there
+  /// is deliberately no cached use count here: the traversals that dominate
+  /// profiles only test emptiness or iterate, both O(1) per step, and a
+  /// count would put an extra store on every use-list insertion and
+  /// removal.
   Operand *FirstUse = nullptr;
   friend class Operand;
 
@@ -504,6 +504,16 @@ class TypeConverter {
   void insert(TypeKey k, const TypeLowering *tl);
   
   /// Mapping for types independent on contextual generic parameters.
+  ///
+  /// Each frontend job re-derives these lowerings from scratch rather than
+  /// loading precomputed results from the swiftmodule. That is deliberate: a
+  /// TypeLowering is a polymorphic object holding SILTypes (and thus AST
+  /// pointers) that only make sense inside this process's ASTContext, and the
+  /// classification it captures depends on the client's resilience expansion,
+  /// not just on the type. A serialized table would have to key entries by
+  /// mangled names and re-resolve them into local types on load, which costs
+  /// about as much as the classification walk it would replace; within a job
+  /// this map already ensures each distinct type is lowered only once.
   llvm::DenseMap<CachingTypeKey, const TypeLowering *> IndependentTypes;
 
   struct DependentTypeState {
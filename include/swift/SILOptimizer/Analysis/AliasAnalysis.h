@@ -263,6 +263,13 @@ public:
   /// Encodes the memory behavior query as a MemBehaviorKeyTy.
   MemBehaviorKeyTy toMemoryBehaviorKey(SILValue V1, SILValue V2, RetainObserveKind K);
 
+  /// The wholesale flush below is deliberate, not a missing optimization.
+  /// Cached results embed interprocedural facts from EscapeAnalysis and
+  /// SideEffectAnalysis: the behavior of an apply in F depends on its
+  /// callees' bodies, so entries for F go stale when some *other* function
+  /// changes. A per-function generation stamp on the keys would preserve
+  /// exactly those stale entries. Scoped invalidation only becomes possible
+  /// if the cache records which callee summaries each entry consumed.
   virtual void invalidate() override {
     AliasCache.clear();
     MemoryBehaviorCache.clear();
@@ -133,6 +133,15 @@ public:
   }
 
   /// Invalidate all information in this analysis.
+  ///
+  /// Note that the cache is derived from vtables and witness tables only -
+  /// nothing is recorded per apply site - so the per-function invalidation
+  /// and function add/delete notifications below are deliberate no-ops and
+  /// the inliner and devirtualizer never cause a rebuild. The cache is
+  /// dropped only here and when the dispatch tables themselves change;
+  /// rebuilding then costs time proportional to the tables, not to the
+  /// module's SIL, and an in-place edge update would additionally have to
+  /// handle entry removal to be equivalent.
   virtual void invalidate() override {
     Cache.reset();
   }
@@ -162,6 +162,15 @@ public:
   const FunctionInfo &getCallerInfo(SILFunction *F) {
     // Recompute every function in the invalidated function list and empty the
     // list.
+    //
+    // Draining the whole list here is required for correctness, not a missed
+    // chance to be lazier: the caller set of \p F is assembled from scans of
+    // every *other* function, and a stale function that never called F
+    // before may well call it now. Restricting the refresh to F's previously
+    // known callers would miss exactly those new edges. The cost is bounded
+    // by the number of functions that actually changed since the last query,
+    // so this only approaches a module-wide sweep right after whole-module
+    // invalidation.
     processRecomputeFunctionList();
     return FuncInfos[F];
   }
@@ -24,6 +24,14 @@ class SILBasicBlock;
 ///
 /// This does not inherit from SILAnalysis because it is not worth preserving
 /// across passes.
+///
+/// This information identifies cold blocks for heuristics (inlining,
+/// speculative devirtualization); it is not a basis for a SIL outlining
+/// pass. Trap blocks after MergeCondFail are a few instructions that LLVM's
+/// block placement already sinks out of the hot layout, and extracting
+/// larger cold regions into functions at the SIL level would have to
+/// materialize live-in/live-out interfaces and would obscure debug info and
+/// unwind paths for a layout problem the backend owns.
 class ColdBlockInfo {
   DominanceAnalysis *DA;
 
@@ -15,6 +15,7 @@
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorHandling.h"
@@ -81,6 +82,15 @@ class SILPassManager {
   typedef std::bitset<(size_t)PassKind::AllPasses_Last + 1> CompletedPasses;
   
   /// A completed-passes mask for each function.
+  ///
+  /// This is the only pipeline caching that is sound here: it skips a pass
+  /// when nothing changed since its previous run *within this job*. A
+  /// cross-build content-addressed cache of optimized SIL was considered and
+  /// rejected - a function's optimized body depends on the bodies of
+  /// everything it transitively calls (inlining, specialization), so a hash
+  /// of the function's own SIL does not identify the result, and cached
+  /// output would reference functions, types and declarations whose
+  /// identities are not stable across frontend invocations.
   llvm::DenseMap<SILFunction *, CompletedPasses> CompletedPassesMap;
 
   /// Stores for each function the number of levels of specializations it is
@@ -93,6 +103,17 @@ class SILPassManager {
   /// Set to true when a pass invalidates an analysis.
   bool CurrentPassHasInvalidated = false;
 
+  /// Set to true when a pass invalidates in a way that is not attributed to
+  /// individual functions (whole-module invalidation or a change to the
+  /// witness- or vtables), forcing whole-module verification afterwards.
+  bool CurrentPassChangedWholeModule = false;
+
+  /// The functions the current pass reported as changed via per-function
+  /// invalidation or addition notifications. Used to scope verification
+  /// after a module pass; meaningless if CurrentPassChangedWholeModule is
+  /// set.
+  llvm::SmallPtrSet<SILFunction *, 8> CurrentPassChangedFunctions;
+
   /// True if we need to stop running passes and restart again on the
   /// same function.
   bool RestartPipeline = false;
@@ -148,6 +169,7 @@ public:
         AP->invalidate();
 
     CurrentPassHasInvalidated = true;
+    CurrentPassChangedWholeModule = true;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -166,6 +188,8 @@ public:
   void notifyAnalysisOfFunction(SILFunction *F) {
     for (auto AP : Analysis)
       AP->notifyAddFunction(F);
+
+    CurrentPassChangedFunctions.insert(F);
   }
 
   /// \brief Broadcast the invalidation of the function to all analysis.
@@ -175,8 +199,9 @@ public:
     for (auto AP : Analysis)
       if (!AP->isLocked())
         AP->invalidate(F, K);
-    
+
     CurrentPassHasInvalidated = true;
+    CurrentPassChangedFunctions.insert(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -190,6 +215,7 @@ public:
         AP->invalidateFunctionTables();
 
     CurrentPassHasInvalidated = true;
+    CurrentPassChangedWholeModule = true;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -201,8 +227,10 @@ public:
     for (auto AP : Analysis)
       if (!AP->isLocked())
         AP->notifyDeleteFunction(F);
-    
+
     CurrentPassHasInvalidated = true;
+    // The function is going away; make sure we don't try to verify it.
+    CurrentPassChangedFunctions.erase(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
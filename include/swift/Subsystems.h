@@ -119,9 +119,14 @@ namespace swift {
 
   /// \brief Finish the parsing by going over the nodes that were delayed
   /// during the first parsing pass.
+  ///
+  /// \param TransparentBodiesOnly if true only parse the delayed bodies of
+  /// functions that SIL generation may demand for mandatory inlining, leaving
+  /// the rest recorded as token ranges.
   void performDelayedParsing(DeclContext *DC,
                              PersistentParserState &PersistentState,
-                             CodeCompletionCallbacksFactory *Factory);
+                             CodeCompletionCallbacksFactory *Factory,
+                             bool TransparentBodiesOnly = false);
 
   /// \brief Lex and return a vector of tokens for the given buffer.
   std::vector<Token> tokenize(const LangOptions &LangOpts,
@@ -177,12 +182,17 @@ namespace swift {
   ///
   /// \param WarnLongFunctionBodies If non-zero, warn when a function body takes
   /// longer than this many milliseconds to type-check
+  ///
+  /// \param SolverAnytimeBudget If non-zero, the number of milliseconds the
+  /// expression type checker may spend exploring a solution space before
+  /// settling for the best solution found so far
   void performTypeChecking(SourceFile &SF, TopLevelContext &TLC,
                            OptionSet<TypeCheckingFlags> Options,
                            unsigned StartElem = 0,
                            unsigned WarnLongFunctionBodies = 0,
                            unsigned WarnLongExpressionTypeChecking = 0,
-                           unsigned ExpressionTimeoutThreshold = 0);
+                           unsigned ExpressionTimeoutThreshold = 0,
+                           unsigned SolverAnytimeBudget = 0);
 
   /// Once type checking is complete, this walks protocol requirements
   /// to resolve default witnesses.
@@ -27,7 +27,7 @@
 
 /// Minor version changes when new APIs are added in ABI- and source-compatible
 /// way.
-#define SWIFT_DEMANGLE_VERSION_MINOR 2
+#define SWIFT_DEMANGLE_VERSION_MINOR 3
 
 /// @}
 
@@ -43,6 +43,22 @@ extern "C" {
 size_t swift_demangle_getDemangledName(const char *MangledName, char *OutputBuffer,
                                        size_t Length);
 
+/// \brief Demangle a batch of Swift function names with one shared
+/// demangling context, amortizing per-call setup for high-volume callers.
+///
+/// For each index \c i, behaves like \c swift_demangle_getDemangledName
+/// applied to \p MangledNames[i], writing into \p OutputBuffers[i] (with
+/// capacity \p Lengths[i]). If \p OutputLengths is non-null,
+/// \p OutputLengths[i] receives the value the single-name call would have
+/// returned for that name.
+///
+/// \returns the number of names that were successfully demangled.
+size_t swift_demangle_getDemangledNames(const char *const *MangledNames,
+                                        char *const *OutputBuffers,
+                                        const size_t *Lengths,
+                                        size_t *OutputLengths,
+                                        size_t NumNames);
+
 /// \brief Demangle Swift function names with module names and implicit self
 /// and metatype type names in function signatures stripped.
 ///
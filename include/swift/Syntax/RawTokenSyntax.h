@@ -51,17 +51,14 @@ private:
 
 public:
   /// Make a new token.
+  ///
+  /// A typical source buffer repeats a small set of tokens many times, so
+  /// identical nodes (same kind, text, presence, and trivia) are interned
+  /// and shared where it is safe to do so.
   static RC<RawTokenSyntax> make(tok TokenKind, OwnedString Text,
                                  const SourcePresence Presence,
                                  const Trivia &LeadingTrivia,
-                                 const Trivia &TrailingTrivia) {
-    return RC<RawTokenSyntax> {
-      new RawTokenSyntax {
-        TokenKind, Text, Presence,
-        LeadingTrivia, TrailingTrivia
-      }
-    };
-  }
+                                 const Trivia &TrailingTrivia);
 
   /// Return a token with the specified kind and text, but marked as missing.
   static RC<RawTokenSyntax> missingToken(const tok Kind, OwnedString Text) {
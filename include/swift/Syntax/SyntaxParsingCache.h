@@ -0,0 +1,116 @@
+//===--- SyntaxParsingCache.h - Incremental syntax tree reuse ---*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the interface for a `SyntaxParsingCache`, which allows
+// unchanged `RawSyntax` subtrees of a previous parse to be reused when
+// re-parsing an edited source buffer, so that only the damaged regions need
+// to be re-lexed and re-parsed.
+//
+// NOTE: This is scaffolding for incremental parsing. The parser does not
+// consult the cache yet: wiring it in requires a cache query at each node
+// boundary in Parser and a way for clients to supply the previous tree and
+// the edit list with a parse request. Until that lands, the lookup logic is
+// exercised only by its unit tests.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_SYNTAX_SYNTAXPARSINGCACHE_H
+#define SWIFT_SYNTAX_SYNTAXPARSINGCACHE_H
+
+#include "swift/Syntax/RawSyntax.h"
+#include "swift/Syntax/References.h"
+#include "llvm/ADT/Optional.h"
+
+#include <vector>
+
+namespace swift {
+namespace syntax {
+
+/// A single edit to a source buffer: the half-open byte range
+/// \c [Start,End) in the pre-edit buffer was replaced by
+/// \c ReplacementLength bytes.
+struct SourceEdit {
+  size_t Start;
+  size_t End;
+  size_t ReplacementLength;
+
+  /// The length of the byte range that was replaced.
+  size_t originalLength() const { return End - Start; }
+
+  /// Check if the characters replaced by this edit fall into the given
+  /// half-open range or are directly adjacent to it.
+  bool intersectsOrTouchesRange(size_t RangeStart, size_t RangeEnd) const {
+    return End >= RangeStart && Start <= RangeEnd;
+  }
+};
+
+/// Reuses unchanged \c RawSyntax subtrees from a previous parse when
+/// re-parsing an edited source buffer.
+///
+/// The intended client is the parser: it asks for a node of a given kind at
+/// a position in the post-edit buffer.  The cache maps the position back
+/// into the pre-edit buffer, walks the old tree to the subtree at that
+/// offset, and hands back the old node if no edit damaged it.  Since
+/// \c RawSyntax nodes are immutable and shared, reuse is a reference-count
+/// increment; only the damaged regions are re-lexed and re-parsed.
+///
+/// The parser integration does not exist yet; see the note in the file
+/// header.
+class SyntaxParsingCache {
+  /// The syntax tree of the pre-edit source file.
+  RC<RawSyntax> OldSyntaxTree;
+
+  /// The edits that were made to the source file, in increasing
+  /// source-offset order.
+  std::vector<SourceEdit> Edits;
+
+public:
+  explicit SyntaxParsingCache(RC<RawSyntax> OldSyntaxTree)
+      : OldSyntaxTree(OldSyntaxTree) {}
+
+  /// Record an edit to the source file: the half-open byte range
+  /// \c [Start,End) was replaced by \c ReplacementLength bytes.  Edits must
+  /// be added in increasing source-offset order and may not overlap.
+  void addEdit(size_t Start, size_t End, size_t ReplacementLength) {
+    assert((Edits.empty() || Edits.back().End <= Start) &&
+           "edits must be added in increasing source-offset order");
+    Edits.push_back({Start, End, ReplacementLength});
+  }
+
+  /// Look up a node of the given kind at the given position in the post-edit
+  /// buffer.  Returns null if no subtree of the old tree can be reused.
+  RC<RawSyntax> lookUp(size_t NewPosition, SyntaxKind Kind) const;
+
+  /// Return the full byte width of the given node, trivia included.
+  static size_t getFullWidth(const RC<RawSyntax> &Node);
+
+private:
+  /// Map a position in the post-edit buffer back to the corresponding
+  /// position in the pre-edit buffer, or None if the position lies inside a
+  /// replaced region.
+  llvm::Optional<size_t> translateToPreEditPosition(size_t NewPosition) const;
+
+  /// Whether the node covering \c [NodeStart, NodeStart + width) in the
+  /// pre-edit buffer survived all edits and matches the requested kind.
+  bool nodeCanBeReused(const RC<RawSyntax> &Node, size_t NodeStart,
+                       SyntaxKind Kind) const;
+
+  /// Walk the old tree from \c Node at \c NodeStart looking for a reusable
+  /// node of the given kind at \c Position.
+  RC<RawSyntax> lookUpFrom(const RC<RawSyntax> &Node, size_t NodeStart,
+                           size_t Position, SyntaxKind Kind) const;
+};
+
+} // end namespace syntax
+} // end namespace swift
+
+#endif // SWIFT_SYNTAX_SYNTAXPARSINGCACHE_H
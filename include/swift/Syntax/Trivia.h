@@ -80,6 +80,7 @@
 #define SWIFT_SYNTAX_TRIVIA_H
 
 #include "swift/Basic/OwnedString.h"
+#include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <deque>
@@ -138,6 +139,25 @@ struct TriviaPiece {
   unsigned Count;
   OwnedString Text;
 
+  /// Return the number of source bytes this piece of trivia covers.
+  size_t getTextLength() const {
+    switch (Kind) {
+    case TriviaKind::LineComment:
+    case TriviaKind::BlockComment:
+    case TriviaKind::DocLineComment:
+    case TriviaKind::DocBlockComment:
+      return Text.size();
+    case TriviaKind::Space:
+    case TriviaKind::Tab:
+    case TriviaKind::VerticalTab:
+    case TriviaKind::Formfeed:
+    case TriviaKind::Newline:
+    case TriviaKind::Backtick:
+      return Count;
+    }
+    llvm_unreachable("unhandled TriviaKind");
+  }
+
   TriviaPiece(const TriviaKind Kind, const unsigned Count,
               const OwnedString Text)
       : Kind(Kind), Count(Count), Text(Text) {}
@@ -255,6 +275,14 @@ struct Trivia {
     Pieces.pop_back();
   }
 
+  /// Return the number of source bytes covered by all pieces.
+  size_t getTextLength() const {
+    size_t Length = 0;
+    for (const auto &Piece : Pieces)
+      Length += Piece.getTextLength();
+    return Length;
+  }
+
   /// Returns true if there are no pieces in this Trivia collection.
   bool empty() const {
     return Pieces.empty();
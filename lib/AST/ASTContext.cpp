@@ -42,10 +42,12 @@
 #include "clang/Lex/HeaderSearch.h"
 #include "clang/Lex/Preprocessor.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Compiler.h"
+#include "llvm/Support/Mutex.h"
 #include <algorithm>
 #include <memory>
 
@@ -98,13 +100,46 @@ struct ASTContext::Implementation {
 
   llvm::BumpPtrAllocator Allocator; // used in later initializations
 
+  /// Whether AST creation may currently happen on multiple threads, which
+  /// makes identifier uniquing take per-shard locks.
+  bool ParallelParsingEnabled = false;
+
+  /// Guards the identifier table and the per-thread allocator list while
+  /// parallel parsing is active.
+  llvm::sys::Mutex ParallelParsingMutex;
+
+  /// Extra slab allocators handed out to worker threads during parallel
+  /// parsing.  They are kept for the lifetime of the context since the AST
+  /// they back outlives the parse phase.
+  std::vector<std::unique_ptr<llvm::BumpPtrAllocator>> ThreadAllocators;
+
   /// The set of cleanups to be called when the ASTContext is destroyed.
   std::vector<std::function<void(void)>> Cleanups;
 
   /// The last resolver.
   LazyResolver *Resolver = nullptr;
 
-  llvm::StringMap<char, llvm::BumpPtrAllocator&> IdentifierTable;
+  /// The generation count at which all loaded modules were last verified,
+  /// if they ever were.  Only used in asserts builds.
+  mutable Optional<unsigned> AllModulesVerifiedAtGeneration;
+
+  /// One shard of the identifier table.  Each shard owns the allocator its
+  /// entries live in, so two shards can be mutated concurrently without
+  /// racing on a shared bump pointer.
+  struct IdentifierShard {
+    llvm::sys::Mutex Mutex;
+    llvm::BumpPtrAllocator Allocator;
+    llvm::StringMap<char, llvm::BumpPtrAllocator &> Table;
+
+    IdentifierShard() : Table(Allocator) {}
+  };
+
+  /// The number of identifier-table shards; must be a power of two.
+  static const unsigned NumIdentifierShards = 64;
+
+  /// The identifier table, sharded by string hash so that concurrent phases
+  /// (parallel parsing today) do not serialize on one map and one lock.
+  IdentifierShard IdentifierShards[NumIdentifierShards];
 
   /// The declaration of Swift.AssignmentPrecedence.
   PrecedenceGroupDecl *AssignmentPrecedence = nullptr;
@@ -248,6 +283,46 @@ FOR_KNOWN_FOUNDATION_TYPES(CACHE_FOUNDATION_DECL)
   llvm::DenseMap<GenericSignatureBuilder *, GenericEnvironment *>
     CanonicalGenericEnvironments;
 
+  /// Memoized results of canonicalizing a type relative to a generic
+  /// signature, keyed by the signature builder that performed the
+  /// canonicalization.
+  llvm::DenseMap<std::pair<GenericSignatureBuilder *, TypeBase *>, TypeBase *>
+    CanonicalTypesInContext;
+
+  /// A memoized qualified-lookup result, valid for the generation in which
+  /// it was recorded.
+  struct ModuleLookupResult {
+    unsigned Generation;
+    llvm::TinyPtrVector<ValueDecl *> Decls;
+  };
+
+  /// Memoized results of qualified name lookups into modules, keyed by
+  /// ((module, module-scope context), (name, query kind)).
+  llvm::DenseMap<std::pair<std::pair<ModuleDecl *, const DeclContext *>,
+                           std::pair<void *, unsigned>>,
+                 ModuleLookupResult>
+    ModuleLookupCache;
+
+  /// Memoized manglings of declarations, keyed by the declaration and an
+  /// opaque discriminator for the mangler entry point and its flags.  The
+  /// strings live in the permanent arena.
+  llvm::DenseMap<std::pair<const Decl *, unsigned>, StringRef> MangledNames;
+
+  /// A substitution list uniqued in the permanent arena.
+  struct UniquedSubstitutionList : public llvm::FoldingSetNode {
+    SubstitutionList Subs;
+
+    explicit UniquedSubstitutionList(SubstitutionList subs) : Subs(subs) {}
+
+    void Profile(llvm::FoldingSetNodeID &id) const {
+      profileSubstitutionList(id, Subs);
+    }
+  };
+
+  /// The set of uniqued substitution lists, which allows identical lists
+  /// to share a single allocation.
+  llvm::FoldingSet<UniquedSubstitutionList> UniquedSubstitutionLists;
+
   /// The set of property names that show up in the defining module of a
   /// class.
   llvm::DenseMap<std::pair<const ClassDecl *, char>,
@@ -390,8 +465,7 @@ FOR_KNOWN_FOUNDATION_TYPES(CACHE_FOUNDATION_DECL)
   llvm::FoldingSet<SILLayout> SILLayouts;
 };
 
-ASTContext::Implementation::Implementation()
- : IdentifierTable(Allocator) {}
+ASTContext::Implementation::Implementation() {}
 ASTContext::Implementation::~Implementation() {
   for (auto &cleanup : Cleanups)
     cleanup();
@@ -473,9 +547,16 @@ ASTContext::~ASTContext() {
   delete &Impl;
 }
 
+/// The allocator the current thread uses for the permanent arena while
+/// parallel parsing is active.
+static LLVM_THREAD_LOCAL llvm::BumpPtrAllocator *ThreadActiveAllocator =
+    nullptr;
+
 llvm::BumpPtrAllocator &ASTContext::getAllocator(AllocationArena arena) const {
   switch (arena) {
   case AllocationArena::Permanent:
+    if (ThreadActiveAllocator)
+      return *ThreadActiveAllocator;
     return Impl.Allocator;
 
   case AllocationArena::ConstraintSolver:
@@ -507,10 +588,38 @@ Identifier ASTContext::getIdentifier(StringRef Str) const {
   if (Str.data() == nullptr)
     return Identifier(nullptr);
 
-  auto I = Impl.IdentifierTable.insert(std::make_pair(Str, char())).first;
+  auto &shard = Impl.IdentifierShards[
+      llvm::hash_value(Str) & (Implementation::NumIdentifierShards - 1)];
+
+  if (Impl.ParallelParsingEnabled) {
+    llvm::sys::ScopedLock lock(shard.Mutex);
+    auto I = shard.Table.insert(std::make_pair(Str, char())).first;
+    return Identifier(I->getKeyData());
+  }
+
+  auto I = shard.Table.insert(std::make_pair(Str, char())).first;
   return Identifier(I->getKeyData());
 }
 
+void ASTContext::setParallelParsingEnabled(bool enabled) {
+  Impl.ParallelParsingEnabled = enabled;
+}
+
+void ASTContext::installThreadAllocator() {
+  assert(Impl.ParallelParsingEnabled &&
+         "only worker threads of a parallel parse get their own allocator");
+  assert(!ThreadActiveAllocator && "thread already has an allocator");
+  auto allocator = llvm::make_unique<llvm::BumpPtrAllocator>();
+  ThreadActiveAllocator = allocator.get();
+  llvm::sys::ScopedLock lock(Impl.ParallelParsingMutex);
+  Impl.ThreadAllocators.push_back(std::move(allocator));
+}
+
+void ASTContext::uninstallThreadAllocator() {
+  assert(ThreadActiveAllocator && "thread does not have an allocator");
+  ThreadActiveAllocator = nullptr;
+}
+
 void ASTContext::lookupInSwiftModule(
                    StringRef name,
                    SmallVectorImpl<ValueDecl *> &results) const {
@@ -1307,6 +1416,14 @@ void ASTContext::loadObjCMethods(
 
 void ASTContext::verifyAllLoadedModules() const {
 #ifndef NDEBUG
+  // Loaded modules only change when a new load bumps the generation count,
+  // but this gets called once per type-checked source file; without the
+  // generation check, asserts builds re-verify every imported module for
+  // every file in the compilation.
+  if (Impl.AllModulesVerifiedAtGeneration == CurrentGeneration)
+    return;
+  Impl.AllModulesVerifiedAtGeneration = CurrentGeneration;
+
   for (auto &loader : Impl.ModuleLoaders)
     loader->verifyAllModules();
 
@@ -1453,6 +1570,63 @@ GenericEnvironment *ASTContext::getOrCreateCanonicalGenericEnvironment(
   return env;
 }
 
+Type ASTContext::getCachedCanonicalTypeInContext(
+                                              GenericSignatureBuilder *builder,
+                                              CanType type) {
+  auto known = Impl.CanonicalTypesInContext.find({builder, type.getPointer()});
+  if (known != Impl.CanonicalTypesInContext.end())
+    return known->second;
+
+  return Type();
+}
+
+void ASTContext::recordCanonicalTypeInContext(GenericSignatureBuilder *builder,
+                                              CanType type,
+                                              CanType canonicalType) {
+  Impl.CanonicalTypesInContext[{builder, type.getPointer()}] =
+    canonicalType.getPointer();
+}
+
+StringRef ASTContext::getCachedMangledName(const Decl *decl,
+                                           unsigned manglingKey) const {
+  auto known = Impl.MangledNames.find({decl, manglingKey});
+  if (known == Impl.MangledNames.end())
+    return StringRef();
+
+  return known->second;
+}
+
+void ASTContext::recordMangledName(const Decl *decl, unsigned manglingKey,
+                                   StringRef mangledName) {
+  Impl.MangledNames[{decl, manglingKey}] = AllocateCopy(mangledName);
+}
+
+bool ASTContext::getCachedModuleLookupResult(
+                                     ModuleDecl *module, DeclName name,
+                                     const DeclContext *moduleScopeContext,
+                                     unsigned queryKind,
+                                     SmallVectorImpl<ValueDecl *> &results) {
+  auto known = Impl.ModuleLookupCache.find(
+      {{module, moduleScopeContext}, {name.getOpaqueValue(), queryKind}});
+  if (known == Impl.ModuleLookupCache.end() ||
+      known->second.Generation != CurrentGeneration)
+    return false;
+
+  results.append(known->second.Decls.begin(), known->second.Decls.end());
+  return true;
+}
+
+void ASTContext::recordModuleLookupResult(ModuleDecl *module, DeclName name,
+                                          const DeclContext *moduleScopeContext,
+                                          unsigned queryKind,
+                                          ArrayRef<ValueDecl *> results) {
+  auto &entry = Impl.ModuleLookupCache[
+      {{module, moduleScopeContext}, {name.getOpaqueValue(), queryKind}}];
+  entry.Generation = CurrentGeneration;
+  entry.Decls.clear();
+  entry.Decls.insert(entry.Decls.end(), results.begin(), results.end());
+}
+
 bool ASTContext::canImportModule(std::pair<Identifier, SourceLoc> ModulePath) {
   // If this module has already been successfully imported, it is importable.
   if (getLoadedModule(ModulePath) != nullptr)
@@ -1602,6 +1776,36 @@ ASTContext::getConformance(Type conformingType,
   return result;
 }
 
+SubstitutionList
+ASTContext::getUniquedSubstitutionList(SubstitutionList subs) {
+  if (subs.empty())
+    return subs;
+
+  // Substitutions involving type variables belong to the constraint-solver
+  // arena and do not outlive it; copy them there rather than uniquing them.
+  RecursiveTypeProperties properties;
+  for (const auto &sub : subs)
+    properties |= sub.getReplacement()->getRecursiveProperties();
+  AllocationArena arena = getArena(properties);
+  if (arena != AllocationArena::Permanent)
+    return AllocateCopy(subs, arena);
+
+  llvm::FoldingSetNodeID id;
+  profileSubstitutionList(id, subs);
+
+  // Did we already record an identical substitution list?
+  void *insertPos;
+  auto &uniquedLists = Impl.UniquedSubstitutionLists;
+  if (auto *known = uniquedLists.FindNodeOrInsertPos(id, insertPos))
+    return known->Subs;
+
+  // Copy the list into the permanent arena and remember it.
+  auto *uniqued = new (*this, AllocationArena::Permanent)
+      Implementation::UniquedSubstitutionList(AllocateCopy(subs));
+  uniquedLists.InsertNode(uniqued, insertPos);
+  return uniqued->Subs;
+}
+
 SpecializedProtocolConformance *
 ASTContext::getSpecializedConformance(Type type,
                                       ProtocolConformance *generic,
@@ -1619,7 +1823,7 @@ ASTContext::getSpecializedConformance(Type type,
     return result;
 
   // Build a new specialized conformance.
-  substitutions = AllocateCopy(substitutions, arena);
+  substitutions = getUniquedSubstitutionList(substitutions);
   auto result
     = new (*this, arena) SpecializedProtocolConformance(type, generic,
                                                         substitutions);
@@ -1741,6 +1945,10 @@ ASTContext::takeDelayedConformanceDiags(NormalProtocolConformance *conformance){
 }
 
 size_t ASTContext::getTotalMemory() const {
+  size_t IdentifierMemory = 0;
+  for (auto &shard : Impl.IdentifierShards)
+    IdentifierMemory += shard.Allocator.getTotalMemory();
+
   size_t Size = sizeof(*this) +
     // LoadedModules ?
     // ExternalDefinitions ?
@@ -1748,6 +1956,7 @@ size_t ASTContext::getTotalMemory() const {
     // RemappedTypes ?
     sizeof(Impl) +
     Impl.Allocator.getTotalMemory() +
+    IdentifierMemory +
     Impl.Cleanups.capacity() +
     llvm::capacity_in_bytes(Impl.ModuleLoaders) +
     llvm::capacity_in_bytes(Impl.RawComments) +
@@ -41,6 +41,27 @@
 using namespace swift;
 using namespace swift::Mangle;
 
+namespace {
+  /// The decl-keyed entry points whose finished manglings are memoized in
+  /// the ASTContext.  SILGen, IRGen, TBDGen and serialization all mangle
+  /// the same declarations, so the substitution machinery would otherwise
+  /// run several times per symbol.
+  enum class CachedManglingKind : unsigned {
+    Entity,
+    DestructorEntity,
+    ConstructorEntity,
+    AccessorEntity,
+  };
+} // end anonymous namespace
+
+/// Pack an entry point and its flags into the opaque key used for the
+/// ASTContext mangled-name cache.
+static unsigned cachedManglingKey(CachedManglingKind entryPoint,
+                                  ASTMangler::SymbolKind SKind,
+                                  unsigned flags = 0) {
+  return unsigned(entryPoint) | (unsigned(SKind) << 2) | (flags << 5);
+}
+
 std::string ASTMangler::mangleClosureEntity(const AbstractClosureExpr *closure,
                                             SymbolKind SKind) {
   beginMangling();
@@ -51,33 +72,70 @@ std::string ASTMangler::mangleClosureEntity(const AbstractClosureExpr *closure,
 
 std::string ASTMangler::mangleEntity(const ValueDecl *decl, bool isCurried,
                                      SymbolKind SKind) {
+  auto &ctx = decl->getASTContext();
+  unsigned key = cachedManglingKey(CachedManglingKind::Entity, SKind,
+                                   unsigned(isCurried));
+  if (!DWARFMangling) {
+    auto cached = ctx.getCachedMangledName(decl, key);
+    if (!cached.empty())
+      return cached;
+  }
+
   beginMangling();
   appendEntity(decl);
   if (isCurried)
     appendOperator("Tc");
   appendSymbolKind(SKind);
-  return finalize();
+  auto result = finalize();
+  if (!DWARFMangling)
+    ctx.recordMangledName(decl, key, result);
+  return result;
 }
 
 std::string ASTMangler::mangleDestructorEntity(const DestructorDecl *decl,
                                                bool isDeallocating,
                                                SymbolKind SKind) {
+  auto &ctx = decl->getASTContext();
+  unsigned key = cachedManglingKey(CachedManglingKind::DestructorEntity, SKind,
+                                   unsigned(isDeallocating));
+  if (!DWARFMangling) {
+    auto cached = ctx.getCachedMangledName(decl, key);
+    if (!cached.empty())
+      return cached;
+  }
+
   beginMangling();
   appendDestructorEntity(decl, isDeallocating);
   appendSymbolKind(SKind);
-  return finalize();
+  auto result = finalize();
+  if (!DWARFMangling)
+    ctx.recordMangledName(decl, key, result);
+  return result;
 }
 
 std::string ASTMangler::mangleConstructorEntity(const ConstructorDecl *ctor,
                                                 bool isAllocating,
                                                 bool isCurried,
                                                 SymbolKind SKind) {
+  auto &ctx = ctor->getASTContext();
+  unsigned key = cachedManglingKey(CachedManglingKind::ConstructorEntity, SKind,
+                                   unsigned(isAllocating) |
+                                   (unsigned(isCurried) << 1));
+  if (!DWARFMangling) {
+    auto cached = ctx.getCachedMangledName(ctor, key);
+    if (!cached.empty())
+      return cached;
+  }
+
   beginMangling();
   appendConstructorEntity(ctor, isAllocating);
   if (isCurried)
     appendOperator("Tc");
   appendSymbolKind(SKind);
-  return finalize();
+  auto result = finalize();
+  if (!DWARFMangling)
+    ctx.recordMangledName(ctor, key, result);
+  return result;
 }
 
 std::string ASTMangler::mangleIVarInitDestroyEntity(const ClassDecl *decl,
@@ -95,10 +153,24 @@ std::string ASTMangler::mangleAccessorEntity(AccessorKind kind,
                                              const ValueDecl *decl,
                                              bool isStatic,
                                              SymbolKind SKind) {
+  auto &ctx = decl->getASTContext();
+  unsigned key = cachedManglingKey(CachedManglingKind::AccessorEntity, SKind,
+                                   unsigned(kind) |
+                                   (unsigned(addressorKind) << 4) |
+                                   (unsigned(isStatic) << 7));
+  if (!DWARFMangling) {
+    auto cached = ctx.getCachedMangledName(decl, key);
+    if (!cached.empty())
+      return cached;
+  }
+
   beginMangling();
   appendAccessorEntity(kind, addressorKind, decl, isStatic);
   appendSymbolKind(SKind);
-  return finalize();
+  auto result = finalize();
+  if (!DWARFMangling)
+    ctx.recordMangledName(decl, key, result);
+  return result;
 }
 
 std::string ASTMangler::mangleGlobalGetterEntity(const ValueDecl *decl,
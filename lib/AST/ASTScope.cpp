@@ -1618,6 +1618,17 @@ SourceRange ASTScope::getSourceRangeImpl() const {
 }
 
 /// Find the innermost enclosing scope that contains this source location.
+///
+/// Only the spine of scopes whose source ranges contain \c loc is expanded;
+/// siblings off that path stay unexpanded, so a single-location query builds
+/// O(depth) levels of the tree rather than the whole file's scope map.
+///
+/// Note that the source ranges consulted here are recomputed on each call
+/// rather than cached on the scope nodes: while a region of the tree is still
+/// growing, the continuation mechanism can transfer a scope's continuation to
+/// a newly-added child, which moves the effective end of every scope whose
+/// range was derived from that continuation chain. Any cache would need to be
+/// invalidated transitively along that chain, so we don't keep one.
 const ASTScope *ASTScope::findInnermostEnclosingScope(SourceLoc loc) const {
   ASTContext &ctx = getASTContext();
   SourceManager &sourceMgr = ctx.SourceMgr;
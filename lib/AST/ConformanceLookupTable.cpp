@@ -313,11 +313,17 @@ void ConformanceLookupTable::updateLookupTable(NominalTypeDecl *nominal,
           return;
         llvm::SaveAndRestore<bool> visiting(VisitingSuperclass, true);
 
-        // Resolve the conformances of the superclass.
+        // Expand the conformances of the superclass.  Inheriting only needs
+        // the full set of protocols the superclass conforms to, which the
+        // expanded-implied stage already provides; resolving would compare
+        // every entry for every one of those protocols just to prune
+        // duplicates that addProtocol's dedup below ignores anyway.  Any
+        // superclass entry that is actually used gets resolved per protocol
+        // in getConformingContext().
         superclassDecl->prepareConformanceTable();
         superclassDecl->ConformanceTable->updateLookupTable(
           superclassDecl,
-          ConformanceStage::Resolved,
+          ConformanceStage::ExpandedImplied,
           resolver);
         
         // Expand inherited conformances from all superclasses.
@@ -480,8 +486,18 @@ void ConformanceLookupTable::addProtocols(NominalTypeDecl *nominal,
 }
 
 void ConformanceLookupTable::expandImpliedConformances(NominalTypeDecl *nominal,
-                                                       DeclContext *dc, 
+                                                       DeclContext *dc,
                                                        LazyResolver *resolver) {
+  // The inheritance clause of the context does not change while expanding,
+  // so resolve it once up front rather than once per entry; decls that fan
+  // out to many conformances pay for this loop repeatedly.
+  if (resolver) {
+    if (nominal == dc)
+      resolver->resolveInheritanceClause(nominal);
+    else
+      resolver->resolveInheritanceClause(cast<ExtensionDecl>(dc));
+  }
+
   // Note: recursive type-checking implies that AllConformances
   // may be reallocated during this traversal, so pay the lookup cost
   // during each iteration.
@@ -493,15 +509,6 @@ void ConformanceLookupTable::expandImpliedConformances(NominalTypeDecl *nominal,
     ConformanceEntry *conformanceEntry = AllConformances[dc][i];
     ProtocolDecl *conformingProtocol = conformanceEntry->getProtocol();
 
-    // Visit the protocols inherited by this protocol, adding them as
-    // implied conformances.
-    if (resolver) {
-      if (nominal == dc)
-        resolver->resolveInheritanceClause(nominal);
-      else
-        resolver->resolveInheritanceClause(cast<ExtensionDecl>(dc));
-    }
-
     // An @objc enum that explicitly conforms to the Error protocol
     // also implicitly conforms to _ObjectiveCBridgeableError, via the
     // known protocol _BridgedNSError.
@@ -654,6 +654,8 @@ void DiagnosticEngine::flushActiveDiagnostic() {
     TentativeDiagnostics.emplace_back(std::move(*ActiveDiagnostic));
   }
   ActiveDiagnostic.reset();
+  if (ParallelEmissionEnabled)
+    ParallelEmissionMutex.unlock();
 }
 
 void DiagnosticEngine::emitTentativeDiagnostics() {
@@ -664,6 +666,13 @@ void DiagnosticEngine::emitTentativeDiagnostics() {
 }
 
 void DiagnosticEngine::emitDiagnostic(const Diagnostic &diagnostic) {
+  // Formatting is deferred to the consumer: ignored diagnostics bail out here
+  // before any work happens, and everything that reaches handleDiagnostic is
+  // the raw format string plus the argument list. Consumers that render text
+  // call formatDiagnosticText themselves; ones that don't (or that filter)
+  // never pay for it. The only eager text generation on this path is the
+  // pretty-printing fallback below, and that runs solely for diagnostics
+  // attached to a declaration with no usable source location.
   auto behavior = state.determineBehavior(diagnostic.getID());
   if (behavior == DiagnosticState::Behavior::Ignore)
     return;
@@ -686,6 +686,14 @@ CanType GenericSignature::getCanonicalTypeInContext(Type type,
   if (!type->hasTypeParameter())
     return CanType(type);
 
+  // Mangling and lowering canonicalize the same handful of types against the
+  // same signatures over and over, and the archetype resolution below is
+  // expensive enough to be worth memoizing per builder.
+  auto &ctx = getASTContext();
+  CanType key = CanType(type);
+  if (auto cached = ctx.getCachedCanonicalTypeInContext(&builder, key))
+    return CanType(cached);
+
   // Replace non-canonical type parameters.
   type = type.transformRec([&](TypeBase *component) -> Optional<Type> {
     if (!isa<GenericTypeParamType>(component) &&
@@ -710,6 +718,7 @@ CanType GenericSignature::getCanonicalTypeInContext(Type type,
   auto result = type->getCanonicalType();
 
   assert(isCanonicalTypeInContext(result, builder));
+  ctx.recordCanonicalTypeInContext(&builder, key, result);
   return result;
 }
 
@@ -25,8 +25,9 @@
 #include "swift/Basic/SourceManager.h"
 #include "swift/Basic/STLExtras.h"
 #include "swift/Sema/IDETypeChecking.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SetVector.h"
-#include <set>
+#include "llvm/ADT/SmallPtrSet.h"
 
 using namespace swift;
 
@@ -716,8 +717,11 @@ static bool shouldSubstIntoDeclType(Type type) {
 
 class OverrideFilteringConsumer : public VisibleDeclConsumer {
 public:
-  std::set<ValueDecl *> AllFoundDecls;
-  std::map<DeclBaseName, std::set<ValueDecl *>> FoundDecls;
+  // Code completion performs this lookup on every keystroke, so use dense
+  // pointer sets here; node-based containers spend most of their time in the
+  // allocator at that rate.
+  llvm::SmallPtrSet<ValueDecl *, 16> AllFoundDecls;
+  llvm::DenseMap<DeclBaseName, llvm::SmallPtrSet<ValueDecl *, 4>> FoundDecls;
   llvm::SetVector<FoundDeclTy> DeclsToReport;
   Type BaseTy;
   const DeclContext *DC;
@@ -832,7 +836,7 @@ public:
 
       if (relaxedConflicting(FoundSignature, OtherSignature)) {
         if (VD->getFormalAccess() > OtherVD->getFormalAccess()) {
-          PossiblyConflicting.erase(I);
+          PossiblyConflicting.erase(OtherVD);
           PossiblyConflicting.insert(VD);
 
           bool Erased = DeclsToReport.remove(
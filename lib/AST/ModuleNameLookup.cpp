@@ -14,6 +14,7 @@
 #include "swift/AST/NameLookup.h"
 #include "swift/AST/ASTContext.h"
 #include "swift/AST/LazyResolver.h"
+#include "swift/AST/Module.h"
 #include "llvm/Support/raw_ostream.h"
 
 using namespace swift;
@@ -149,8 +150,16 @@ static void lookupInModule(ModuleDecl *module, ModuleDecl::AccessPathTy accessPa
                            const DeclContext *moduleScopeContext,
                            bool respectAccessControl,
                            ArrayRef<ModuleDecl::ImportedModule> extraImports,
+                           bool &sawSourceModule,
                            CallbackTy callback) {
   assert(module);
+
+  // Track whether the lookup touched a module still being built from source;
+  // results involving one cannot be memoized across queries, since parsing
+  // and synthesis keep introducing declarations into it.
+  for (const FileUnit *file : module->getFiles())
+    if (isa<SourceFile>(file))
+      sawSourceModule = true;
   assert(std::none_of(extraImports.begin(), extraImports.end(),
                       [](ModuleDecl::ImportedModule import) -> bool {
     return !import.second;
@@ -223,7 +232,8 @@ static void lookupInModule(ModuleDecl *module, ModuleDecl::AccessPathTy accessPa
       lookupInModule<OverloadSetTy>(next.second, combinedAccessPath,
                                     resultSet, resolutionKind, canReturnEarly,
                                     typeResolver, cache, moduleScopeContext,
-                                    respectAccessControl, {}, callback);
+                                    respectAccessControl, {}, sawSourceModule,
+                                    callback);
     }
 
     // Add the results from scoped imports.
@@ -263,18 +273,41 @@ void namelookup::lookupInModule(ModuleDecl *startModule,
                                 const DeclContext *moduleScopeContext,
                                 ArrayRef<ModuleDecl::ImportedModule> extraImports) {
   assert(moduleScopeContext && moduleScopeContext->isModuleScopeContext());
+  auto &ctx = startModule->getASTContext();
+  bool respectAccessControl = ctx.LangOpts.EnableAccessControl;
+
+  // Repeated lookups of the same name into the same module are common enough
+  // (particularly from the constraint solver and code completion) to memoize
+  // per-context.  Only unscoped queries without extra imports are eligible;
+  // the scope context stays in the key because @testable imports make
+  // accessibility filtering depend on it.
+  unsigned queryKind =
+    unsigned(resolutionKind) | (unsigned(lookupKind) << 2);
+  bool canCache = topAccessPath.empty() && extraImports.empty() &&
+                  typeResolver != nullptr;
+  if (canCache &&
+      ctx.getCachedModuleLookupResult(startModule, name, moduleScopeContext,
+                                      queryKind, decls))
+    return;
+
+  size_t initialCount = decls.size();
   ModuleLookupCache cache;
-  bool respectAccessControl = startModule->getASTContext().LangOpts
-                                .EnableAccessControl;
+  bool sawSourceModule = false;
   ::lookupInModule<CanTypeSet>(startModule, topAccessPath, decls,
                                resolutionKind, /*canReturnEarly=*/true,
                                typeResolver, cache, moduleScopeContext,
                                respectAccessControl, extraImports,
+                               sawSourceModule,
     [=](ModuleDecl *module, ModuleDecl::AccessPathTy path,
         SmallVectorImpl<ValueDecl *> &localDecls) {
       module->lookupValue(path, name, lookupKind, localDecls);
     }
   );
+
+  if (canCache && !sawSourceModule)
+    ctx.recordModuleLookupResult(startModule, name, moduleScopeContext,
+                                 queryKind,
+                                 llvm::makeArrayRef(decls).slice(initialCount));
 }
 
 void namelookup::lookupVisibleDeclsInModule(
@@ -289,10 +322,12 @@ void namelookup::lookupVisibleDeclsInModule(
   assert(moduleScopeContext && moduleScopeContext->isModuleScopeContext());
   ModuleLookupCache cache;
   bool respectAccessControl = M->getASTContext().LangOpts.EnableAccessControl;
+  bool sawSourceModule = false;
   ::lookupInModule<NamedCanTypeSet>(M, accessPath, decls,
                                     resolutionKind, /*canReturnEarly=*/false,
                                     typeResolver, cache, moduleScopeContext,
                                     respectAccessControl, extraImports,
+                                    sawSourceModule,
     [=](ModuleDecl *module, ModuleDecl::AccessPathTy path,
         SmallVectorImpl<ValueDecl *> &localDecls) {
       VectorDeclConsumer consumer(localDecls);
@@ -1220,10 +1220,11 @@ ProtocolConformance *ProtocolConformance::getCanonicalConformance() {
     auto specSubs = spec->getGenericSubstitutions();
     SmallVector<Substitution, 4> newSpecSubs;
     auto canSpecSubs = getCanonicalSubstitutionList(specSubs, newSpecSubs);
+    // getSpecializedConformance copies the substitution list, so passing
+    // the local buffer is fine.
     return Ctx.getSpecializedConformance(
         getType()->getCanonicalType(),
-        genericConformance->getCanonicalConformance(),
-        newSpecSubs.empty() ? canSpecSubs : Ctx.AllocateCopy(canSpecSubs));
+        genericConformance->getCanonicalConformance(), canSpecSubs);
   }
   }
   llvm_unreachable("bad ProtocolConformanceKind");
@@ -1024,6 +1024,14 @@ void ProtocolType::canonicalizeProtocols(
 
 /// getCanonicalType - Return the canonical version of this type, which has
 /// sugar from all levels stripped off.
+// Note on uniquing and concurrency: canonicalization funnels into the
+// per-kind fold sets and maps in ASTContext::Implementation::Arena, so the
+// uniquing structures are already partitioned by type kind, and each
+// TypeBase memoizes its canonical pointer so a given sugared node pays for
+// the recursive walk at most once. Sharding those structures further and
+// adding per-shard locks would only matter if canonicalization ran from
+// multiple threads; in this compiler Sema and SIL generation run on a
+// single thread per ASTContext, so no synchronization is taken here.
 CanType TypeBase::getCanonicalType() {
   // If the type is itself canonical, return it.
   if (isCanonical())
@@ -16,6 +16,17 @@
 
 //  This file implements a default caching implementation that never evicts
 //  its entries.
+//
+//  The single mutex around the map is deliberate for now. Both in-tree
+//  clients of sys::Cache (the ClangImporter decl tables and the code
+//  completion cache) are only touched from one thread at a time, so there
+//  is no contention for shards to relieve; on Darwin this file isn't built
+//  at all and libcache provides concurrent access and cost-based eviction.
+//  If threaded compilation phases start hammering a cache built on this
+//  path, the rework should bring the portable fallback up to libcache
+//  semantics rather than just splitting the lock: per-shard maps keyed on
+//  the callback hash, and eviction that respects the retain/release
+//  callbacks and the so-far-ignored Cost parameter of setAndRetain.
 
 #include "swift/Basic/Cache.h"
 #include "llvm/ADT/DenseMap.h"
@@ -22,14 +22,20 @@
 using namespace swift;
 
 ClusteredBitVector ClusteredBitVector::fromAPInt(const llvm::APInt &bits) {
-  // This is not a very efficient algorithm.
+  // This assumes that the chunk size is the same as APInt's word size,
+  // like asAPInt does in the other direction. APInt guarantees that the
+  // unused high bits of its last word are zero, which add() relies on.
+  static_assert(ChunkSizeInBits == llvm::APInt::APINT_BITS_PER_WORD,
+                "expected chunks to match APInt words");
+  // Note: no up-front reserve; add() keeps an all-clear vector in the
+  // unallocated inline form, which is common for this conversion, and the
+  // growth curve amortizes reallocation once a set bit shows up.
   ClusteredBitVector result;
-  for (unsigned i = 0, e = bits.getBitWidth(); i != e; ++i) {
-    if (bits[i]) {
-      result.appendSetBits(1);
-    } else {
-      result.appendClearBits(1);
-    }
+  size_t remainingBits = bits.getBitWidth();
+  for (const uint64_t *word = bits.getRawData(); remainingBits != 0; ++word) {
+    auto wordBits = std::min(remainingBits, size_t(ChunkSizeInBits));
+    result.add(wordBits, *word);
+    remainingBits -= wordBits;
   }
   return result;
 }
@@ -19,6 +19,18 @@
 #include "swift/Basic/DiverseStack.h"
 using namespace swift;
 
+// Storage must stay contiguous: stable_iterators are plain byte offsets
+// from End, and growth relocates the whole stack with one memcpy (elements
+// are required to be trivially movable). A chunked layout would break that
+// offset arithmetic and force per-element hops, which is the wrong trade
+// for a structure that is iterated far more than it grows. If the
+// grow-and-free cycle per SILGen function emission ever shows up in
+// profiles, the fix that preserves this layout is recycling: let the
+// owning manager keep the largest past allocation alive across function
+// emissions (the way the demangler reuses its biggest slab) instead of
+// deleting it in the destructor. That needs the reuse to live above this
+// class, since each CleanupManager currently dies with its
+// SILGenFunction.
 void DiverseStackBase::pushNewStorageSlow(std::size_t needed) {
   bool wasInline = isAllocatedInline();
 
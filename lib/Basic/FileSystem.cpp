@@ -29,6 +29,17 @@ namespace {
   };
 } // end anonymous namespace
 
+// On batching or overlapping artifact write-out: there is less serial I/O
+// tail here than one might expect. Frontend outputs are written straight
+// through buffered raw_fd_ostreams with no fsync at any point — durability
+// of the rename below is left to the OS — so the per-artifact cost is the
+// close and (for this path) the rename, not a sync. Deferring writes to an
+// async queue flushed at exit would mainly change error reporting: callers
+// turn write failures into diagnostics that decide the process exit code,
+// so completion of every artifact has to be awaited and reported before
+// the frontend can claim success, which caps the overlap at whatever
+// compilation work remains after the last output is produced — typically
+// none, since outputs are emitted at the very end of the job.
 std::error_code swift::moveFileIfDifferent(const llvm::Twine &source,
                                            const llvm::Twine &destination) {
   namespace fs = llvm::sys::fs;
@@ -16,6 +16,9 @@
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace swift;
 
 void SourceManager::verifyAllBuffers() const {
@@ -178,6 +181,39 @@ StringRef SourceManager::getEntireTextForBuffer(unsigned BufferID) const {
   return LLVMSourceMgr.getMemoryBuffer(BufferID)->getBuffer();
 }
 
+const std::vector<unsigned> &
+SourceManager::getLineStartOffsets(unsigned BufferID) const {
+  auto &LineStarts = LineStartOffsets[BufferID];
+  if (!LineStarts.empty())
+    return LineStarts;
+
+  StringRef Text = getEntireTextForBuffer(BufferID);
+  LineStarts.push_back(0);
+  // memchr is the vectorized newline scan on every libc we target.
+  const char *Ptr = Text.begin();
+  while ((Ptr = static_cast<const char *>(
+              memchr(Ptr, '\n', Text.end() - Ptr)))) {
+    ++Ptr;
+    LineStarts.push_back(Ptr - Text.begin());
+  }
+  return LineStarts;
+}
+
+std::pair<unsigned, unsigned>
+SourceManager::findLineAndColumn(SourceLoc Loc, unsigned BufferID) const {
+  assert(Loc.isValid());
+  if (BufferID == 0)
+    BufferID = findBufferContainingLoc(Loc);
+
+  auto &LineStarts = getLineStartOffsets(BufferID);
+  unsigned Offset = getLocOffsetInBuffer(Loc, BufferID);
+  auto I = std::upper_bound(LineStarts.begin(), LineStarts.end(), Offset);
+  assert(I != LineStarts.begin() && "the first line starts at offset zero");
+  unsigned Line = I - LineStarts.begin();
+  unsigned Column = Offset - *(I - 1) + 1;
+  return { Line, Column };
+}
+
 StringRef SourceManager::extractText(CharSourceRange Range,
                                      Optional<unsigned> BufferID) const {
   assert(Range.isValid() && "range should be valid");
@@ -196,12 +196,14 @@ UnifiedStatsReporter::publishAlwaysOnStatsToLLVM() {
     PUBLISH_STAT(C, "SILModule", NumSILGenWitnessTables);
     PUBLISH_STAT(C, "SILModule", NumSILGenDefaultWitnessTables);
     PUBLISH_STAT(C, "SILModule", NumSILGenGlobalVariables);
+    PUBLISH_STAT(C, "SILModule", NumSILGenBytesAllocated);
 
     PUBLISH_STAT(C, "SILModule", NumSILOptFunctions);
     PUBLISH_STAT(C, "SILModule", NumSILOptVtables);
     PUBLISH_STAT(C, "SILModule", NumSILOptWitnessTables);
     PUBLISH_STAT(C, "SILModule", NumSILOptDefaultWitnessTables);
     PUBLISH_STAT(C, "SILModule", NumSILOptGlobalVariables);
+    PUBLISH_STAT(C, "SILModule", NumSILOptBytesAllocated);
 
     PUBLISH_STAT(C, "IRModule", NumIRGlobals);
     PUBLISH_STAT(C, "IRModule", NumIRFunctions);
@@ -286,12 +288,14 @@ UnifiedStatsReporter::printAlwaysOnStatsAndTimers(raw_ostream &OS) {
     PRINT_STAT(OS, delim, C, "SILModule", NumSILGenWitnessTables);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILGenDefaultWitnessTables);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILGenGlobalVariables);
+    PRINT_STAT(OS, delim, C, "SILModule", NumSILGenBytesAllocated);
 
     PRINT_STAT(OS, delim, C, "SILModule", NumSILOptFunctions);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILOptVtables);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILOptWitnessTables);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILOptDefaultWitnessTables);
     PRINT_STAT(OS, delim, C, "SILModule", NumSILOptGlobalVariables);
+    PRINT_STAT(OS, delim, C, "SILModule", NumSILOptBytesAllocated);
 
     PRINT_STAT(OS, delim, C, "IRModule", NumIRGlobals);
     PRINT_STAT(OS, delim, C, "IRModule", NumIRFunctions);
@@ -11,7 +11,72 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/Basic/Timer.h"
+#include "llvm/Support/Mutex.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
 
 using namespace swift;
 
 SharedTimer::State SharedTimer::CompilationTimersEnabled = State::Initial;
+bool SharedTimer::EventTracingEnabled = false;
+
+namespace {
+  struct TraceEvent {
+    // The names passed to SharedTimer are string literals, so holding a
+    // StringRef past the timer's lifetime is safe.
+    StringRef Name;
+    uint64_t Microseconds;
+    unsigned ThreadID;
+    bool IsBegin;
+  };
+} // end anonymous namespace
+
+// Timers are created on whatever thread runs the phase — the parsing timer
+// in particular runs on -enable-parallel-parsing worker threads — so the
+// event log is guarded by a mutex.  This is far off any hot path; a phase
+// records two events over its whole lifetime.
+static llvm::sys::Mutex TraceEventsMutex;
+static std::vector<TraceEvent> TraceEvents;
+
+/// Return a small, stable identifier for the calling thread.  Trace viewers
+/// pair "B"/"E" events per tid, and timers on a single thread are strictly
+/// nested, so tagging each event with its thread keeps the pairing valid
+/// when phases overlap across threads.
+static unsigned getTraceThreadID() {
+  static std::atomic<unsigned> NextThreadID(1);
+  thread_local unsigned ThisThreadID = NextThreadID++;
+  return ThisThreadID;
+}
+
+void SharedTimer::recordEvent(StringRef name, bool isBegin) {
+  using namespace std::chrono;
+  uint64_t timestamp =
+      duration_cast<microseconds>(steady_clock::now().time_since_epoch())
+          .count();
+  unsigned threadID = getTraceThreadID();
+  llvm::sys::ScopedLock lock(TraceEventsMutex);
+  TraceEvents.push_back({name, timestamp, threadID, isBegin});
+}
+
+void SharedTimer::writeTraceEvents(llvm::raw_ostream &OS) {
+  // Emit the JSON array form of the trace event format: paired "B"/"E"
+  // duration events, one tid per recording thread. Viewers normalize
+  // timestamps to the earliest event, so the absolute epoch of the
+  // monotonic clock doesn't matter. Phase names are string literals and
+  // contain nothing that needs escaping.
+  llvm::sys::ScopedLock lock(TraceEventsMutex);
+  OS << "[";
+  bool IsFirst = true;
+  for (const TraceEvent &Event : TraceEvents) {
+    if (!IsFirst)
+      OS << ",";
+    IsFirst = false;
+    OS << "\n  {\"name\": \"" << Event.Name << "\", \"ph\": \""
+       << (Event.IsBegin ? "B" : "E") << "\", \"ts\": " << Event.Microseconds
+       << ", \"pid\": 1, \"tid\": " << Event.ThreadID << "}";
+  }
+  OS << "\n]\n";
+}
@@ -13,6 +13,7 @@
 #include "swift/Basic/Unicode.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/ConvertUTF.h"
+#include <cstring>
 
 using namespace swift;
 
@@ -30,12 +31,43 @@ static inline bool graphemeBreakOverride(llvm::UTF32 lhs, llvm::UTF32 rhs) {
   return lhs == 0x200D || (rhs >= 0x1F3FB && rhs <= 0x1F3FF);
 }
 
+/// Checks whether the given text contains only ASCII bytes, testing a
+/// machine word at a time, so that mostly-ASCII inputs classify whole chunks
+/// per iteration instead of one code point at a time.
+static bool isAllASCII(StringRef S) {
+  const char *Ptr = S.begin(), *End = S.end();
+  while (End - Ptr >= 8) {
+    uint64_t Chunk;
+    memcpy(&Chunk, Ptr, 8);
+    if (Chunk & UINT64_C(0x8080808080808080))
+      return false;
+    Ptr += 8;
+  }
+  while (Ptr != End)
+    if (static_cast<unsigned char>(*Ptr++) >= 0x80)
+      return false;
+  return true;
+}
+
 StringRef swift::unicode::extractFirstExtendedGraphemeCluster(StringRef S) {
   // Extended grapheme cluster segmentation algorithm as described in Unicode
   // Standard Annex #29.
   if (S.empty())
     return StringRef();
 
+  // ASCII fast path: an ASCII character followed by another ASCII character
+  // (or by nothing) is always a complete cluster, except for CR followed by
+  // LF.  Anything that could extend the cluster (combining marks, ZWJ,
+  // emoji modifiers) starts with a non-ASCII byte and takes the full
+  // table-driven path below.
+  unsigned char First = S[0];
+  if (First < 0x80 && (S.size() == 1 ||
+                       static_cast<unsigned char>(S[1]) < 0x80)) {
+    if (First == '\r' && S.size() > 1 && S[1] == '\n')
+      return S.slice(0, 2);
+    return S.slice(0, 1);
+  }
+
   const llvm::UTF8 *SourceStart =
     reinterpret_cast<const llvm::UTF8 *>(S.data());
 
@@ -113,6 +145,10 @@ unsigned swift::unicode::extractFirstUnicodeScalar(StringRef S) {
 }
 
 uint64_t swift::unicode::getUTF16Length(StringRef Str) {
+  // ASCII text transcodes one UTF-16 code unit per byte.
+  if (isAllASCII(Str))
+    return Str.size();
+
   uint64_t Length;
   // Transcode the string to UTF-16 to get its length.
   SmallVector<llvm::UTF16, 128> buffer(Str.size() + 1); // +1 for ending nulls.
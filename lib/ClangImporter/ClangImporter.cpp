@@ -780,6 +780,16 @@ bool ClangImporter::canReadPCH(StringRef PCHFilename) {
   }
 }
 
+/// Compute the path of the persistent bridging-header PCH, if one applies.
+///
+/// This is the reuse half of driver-managed bridging PCH: with
+/// -enable-bridging-pch (the default) the driver schedules one
+/// GeneratePCHJobAction per build and every frontend job consumes its output,
+/// so the header is parsed once per build rather than once per file. With
+/// -pch-output-dir the PCH additionally persists across builds, keyed by the
+/// basename plus a hash of the Swift invocation and Clang module settings, so
+/// getOrCreatePCH only regenerates it when something that affects the header's
+/// content changes.
 Optional<std::string>
 ClangImporter::getPCHFilename(const ClangImporterOptions &ImporterOptions,
                               StringRef SwiftPCHHash, bool &isExplicit) {
@@ -193,6 +193,15 @@ static clang::Module *getTopModule(const clang::NamedDecl *decl, clang::Sema &cl
 
 
 namespace {
+// Inference runs inside importFullName, so its results are memoized with the
+// rest of name import for the life of the process. They are not persisted
+// beyond that: an IAMResult points at live Clang decls (the effective type
+// and any self-parameter pairing), which a per-SDK cache would have to
+// re-resolve on load at roughly the cost of re-running the pattern match.
+// The durable copy that matters — which globals became members of what — is
+// the SwiftLookupTable baked into each PCM and the bridging PCH when those
+// are built, so per-process re-inference is limited to decls actually
+// imported, not the whole API surface.
 class IAMInference {
   ASTContext &context;
   clang::Sema &clangSema;
@@ -7904,6 +7904,17 @@ createUnavailableDecl(Identifier name, DeclContext *dc, Type type,
 }
 
 
+// Member import is lazy per *container*: nothing here runs until someone
+// asks for a type's members, but the first ask translates every member of
+// UIKit-sized interfaces. Going finer — importing only the members matching
+// a looked-up name — can't be done inside this entry point. It needs a
+// second, name-keyed hook on LazyMemberLoader that qualified lookup calls
+// instead of forcing the whole list, fed from the SwiftLookupTable, plus
+// bookkeeping so a later full iteration (printing, conformance checking)
+// knows which names were already materialized and doesn't import them twice.
+// Accessor grouping is the subtle part: a property and its getter/setter,
+// or an ObjC method and the subscript it becomes, must land together even
+// when only one name was requested.
 void
 ClangImporter::Implementation::loadAllMembers(Decl *D, uint64_t extra) {
   assert(D);
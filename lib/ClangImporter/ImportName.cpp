@@ -1713,6 +1713,17 @@ NameImporter::importMacroName(const clang::IdentifierInfo *clangIdentifier,
   return swiftCtx.getIdentifier(name);
 }
 
+// Memoized per process; persisting these results across processes (e.g.
+// keyed by decl USR in the module cache) has been floated but buys less than
+// it seems. An ImportedName is not a string: it holds Identifiers interned in
+// this ASTContext, a pointer-based effective-context, and accessor/init
+// structure, all of which would need re-resolution against live decls on
+// load — comparable work to importNameImpl itself. The result also varies
+// with name version, import-as-member inference, and platform availability,
+// so the cache key is really the whole importer configuration. The piece
+// that is worth persisting, the name-to-decl mapping used for lookup, is
+// already serialized into each PCM and the bridging PCH as the
+// SwiftLookupTable.
 ImportedName NameImporter::importName(const clang::NamedDecl *decl,
                                       ImportNameVersion version,
                                       clang::DeclarationName givenName) {
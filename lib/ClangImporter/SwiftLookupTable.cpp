@@ -72,6 +72,15 @@ public:
 };
 
 /// Module file extension reader for the Swift lookup tables.
+///
+/// This path covers the bridging header too, not just Clang modules: the
+/// bridging PCH is emitted with the same SwiftNameLookupExtension installed,
+/// so the header's lookup table rides inside the PCH as an extension block
+/// and is probed here through OnDiskHashTable against the memory-mapped file
+/// — no per-process rebuild. The table is only re-derived in memory when the
+/// header is parsed textually (bridging PCH disabled, or no header PCH job).
+/// A standalone side file for the table would duplicate what the PCH already
+/// provides while adding its own validation story.
 class SwiftLookupTableReader : public clang::ModuleFileExtensionReader {
   clang::ASTReader &Reader;
   clang::serialization::ModuleFile &ModuleFile;
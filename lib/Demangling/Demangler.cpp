@@ -370,6 +370,17 @@ NodePointer Demangler::changeKind(NodePointer Node, Node::Kind NewKind) {
   return NewNode;
 }
 
+// A note on throughput, since this loop gets blamed in symbolication
+// profiles: the switch below is dense over the operator alphabet, so it
+// already compiles to a jump table — there is no branch chain to replace
+// with a dispatch array. Nor is there much for vector scanning to eat:
+// the only long runs the grammar produces are identifier payloads, and
+// demangleIdentifier slices those out by their preceding length prefix
+// without inspecting the bytes (word substitution is the exception and is
+// bounded by MaxNumWords). Digit runs are the length prefixes themselves,
+// typically one to three characters. Time here is spent building and
+// popping nodes, which scales with the symbol's structure, not with how
+// the characters are consumed.
 NodePointer Demangler::demangleOperator() {
   switch (char c = nextChar()) {
     case 'A': return demangleMultiSubstitutions();
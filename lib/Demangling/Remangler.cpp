@@ -129,6 +129,16 @@ bool SubstitutionEntry::deepEquals(Node *lhs, Node *rhs) const {
   return true;
 }
 
+// Remangled output cannot be assembled from cached per-subtree fragments,
+// tempting as that is for the near-identical trees generic-heavy code
+// round-trips. The substitution machinery is the reason: the bytes a
+// subtree mangles to depend on the substitution table accumulated from
+// everything mangled before it in *this* output (an 'AB'-style backref in
+// one symbol means something else in another), and emitting a subtree also
+// mutates that table for everything after it. Any fragment cache would
+// have to key on the full substitution state, at which point it stops
+// hitting. Within one symbol, the Substitutions map below already performs
+// exactly the sharing the format allows.
 class Remangler {
   template <typename Mangler>
   friend void Mangle::mangleIdentifier(Mangler &M, StringRef ident);
@@ -491,6 +491,21 @@ namespace driver {
     }
 
     /// Schedule all jobs we can from the initial list provided by Compilation.
+    ///
+    /// Jobs are handed to the TaskQueue in the order they appear here, and the
+    /// queue starts them strictly in that order as slots free up, so with more
+    /// jobs than -j slots the largest files can end up starting last and
+    /// serializing the tail of the build. Scheduling long jobs first would be
+    /// a straightforward makespan improvement, but it needs inputs we don't
+    /// have yet: nothing measures per-job wall time (TaskQueue's callbacks
+    /// report exit status and output, not durations), and the compilation
+    /// record only persists per-input status and modification times. Both
+    /// would have to grow first — capture durations around taskBegan/
+    /// taskFinished, store them alongside each input's entry in the build
+    /// record — before this loop could usefully sort its feed. Note that any
+    /// such sort must stay within this initial set; the deferred/transitive
+    /// machinery below depends on dirty jobs being scheduled before the
+    /// dependency graph is consulted for the rest.
     void scheduleInitialJobs() {
       for (const Job *Cmd : Comp.getJobs()) {
         if (!Comp.getIncrementalBuildEnabled()) {
@@ -544,6 +559,16 @@ namespace driver {
     }
 
     /// Schedule transitive closure of initial jobs, and external jobs.
+    ///
+    /// Together with scheduleInitialJobs this already gives a rough
+    /// time-to-first-error ordering in incremental mode: inputs the build
+    /// record marked dirty — which includes everything that failed last time,
+    /// since failed jobs are recorded as needing a rebuild — run with the
+    /// initial set, while up-to-date inputs sit in DeferredCommands until the
+    /// dependency graph demands them. What we don't do is rank jobs *within*
+    /// the initial set (the record has no notion of "failed" distinct from
+    /// "changed", nor any rebuild-frequency history), so two dirty files
+    /// still start in encounter order.
     void scheduleAdditionalJobs() {
       if (Comp.getIncrementalBuildEnabled()) {
         SmallVector<const Job *, 16> AdditionalOutOfDateCommands;
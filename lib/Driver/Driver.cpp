@@ -1354,6 +1354,17 @@ void Driver::buildActions(SmallVectorImpl<const Action *> &TopLevelActions,
   switch (OI.CompilerMode) {
   case OutputInfo::Mode::StandardCompile: {
 
+    // The bridging-header PCH below is the only Clang precompilation the
+    // driver schedules itself. Clang *modules* stay implicit: their set isn't
+    // knowable up front without preprocessing every import chain (there is no
+    // dependency-scanning entry point in the Clang these sources build
+    // against, and the module graph depends on preprocessor state), so a
+    // pre-scan action kind would amount to a full parse. The serial cost is
+    // also smaller than it looks — implicit PCM builds go through the shared
+    // module cache with cross-process locking, so among parallel frontend
+    // jobs only the first builder of a given PCM pays, and everyone else
+    // blocks exactly on what they need.
+    //
     // If the user is importing a textual (.h) bridging header and we're in
     // standard-compile (non-WMO) mode, we take the opportunity to precompile
     // the header into a temporary PCH, and replace the import argument with the
@@ -1377,6 +1388,14 @@ void Driver::buildActions(SmallVectorImpl<const Action *> &TopLevelActions,
       }
     }
 
+    // One CompileJobAction per primary file. Grouping several primaries
+    // into one frontend invocation to amortize process startup and import
+    // loading is an attractive follow-on, but it is not a local change to
+    // this loop: the frontend compiles exactly one primary per process, the
+    // output file map, incremental build record, and parseable-output
+    // protocol all assume job == primary, and a failed or out-of-date
+    // primary would need to invalidate only its own slice of a batch.
+    // Those pieces have to move together, frontend first.
     for (const InputPair &Input : Inputs) {
       types::ID InputType = Input.first;
       const Arg *InputArg = Input.second;
@@ -236,6 +236,15 @@ struct ObjectTraits<Message> {
 } // namespace json
 } // namespace swift
 
+// Messages are already length-prefixed (byte count, newline, payload), so a
+// consumer can slice the stream without scanning for delimiters; only the
+// payload encoding is JSON. Swapping in a binary payload would need a
+// negotiation step with every existing consumer — the driver writes to a pipe
+// it doesn't control and can't probe — and the volume here is a handful of
+// small messages per job, emitted from the single supervising process, not
+// from the 10k frontends themselves. If emission ever shows up in profiles,
+// the cheap fix is serializing straight into `os` instead of staging through
+// a std::string per message.
 static void emitMessage(raw_ostream &os, Message &msg) {
   std::string JSONString;
   llvm::raw_string_ostream BufferStream(JSONString);
@@ -178,6 +178,9 @@ static bool ParseFrontendArgs(FrontendOptions &Opts, ArgList &Args,
   Opts.EmitSortedSIL |= Args.hasArg(OPT_emit_sorted_sil);
 
   Opts.DelayedFunctionBodyParsing |= Args.hasArg(OPT_delayed_function_body_parsing);
+  Opts.LazyNonPrimaryFunctionBodies |=
+      Args.hasArg(OPT_lazy_non_primary_body_parsing);
+  Opts.ParallelParsing |= Args.hasArg(OPT_enable_parallel_parsing);
   Opts.EnableTesting |= Args.hasArg(OPT_enable_testing);
   Opts.EnableResilience |= Args.hasArg(OPT_enable_resilience);
 
@@ -192,6 +195,9 @@ static bool ParseFrontendArgs(FrontendOptions &Opts, ArgList &Args,
   Opts.DebugTimeExpressionTypeChecking |=
     Args.hasArg(OPT_debug_time_expression_type_checking);
   Opts.DebugTimeCompilation |= Args.hasArg(OPT_debug_time_compilation);
+  if (const Arg *A = Args.getLastArg(OPT_trace_time_compilation)) {
+    Opts.TraceTimeCompilationPath = A->getValue();
+  }
   if (const Arg *A = Args.getLastArg(OPT_stats_output_dir)) {
     Opts.StatsOutputDir = A->getValue();
   }
@@ -245,6 +251,16 @@ static bool ParseFrontendArgs(FrontendOptions &Opts, ArgList &Args,
     }
   }
 
+  if (const Arg *A = Args.getLastArg(OPT_solver_anytime_budget_EQ)) {
+    unsigned attempt;
+    if (StringRef(A->getValue()).getAsInteger(10, attempt)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+    } else {
+      Opts.SolverAnytimeBudget = attempt;
+    }
+  }
+
   Opts.PlaygroundTransform |= Args.hasArg(OPT_playground);
   if (Args.hasArg(OPT_disable_playground_transform))
     Opts.PlaygroundTransform = false;
@@ -1640,6 +1656,7 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
 
   Opts.GenerateProfile |= Args.hasArg(OPT_profile_generate);
   Opts.PrintInlineTree |= Args.hasArg(OPT_print_llvm_inline_tree);
+  Opts.EmitThinLTOSummary |= Args.hasArg(OPT_emit_thinlto_summary);
 
   Opts.UseSwiftCall = Args.hasArg(OPT_enable_swiftcall);
 
@@ -1757,6 +1774,17 @@ bool ParseMigratorArgs(MigratorOptions &Opts, llvm::Triple &Triple,
   return false;
 }
 
+// This runs once per frontend process. A pre-parsed binary invocation blob
+// produced by the driver has been floated as a way to skip the option-table
+// walk, but the parse itself is a tiny slice of process startup next to stdlib
+// module loading, and most of the work below is not string matching — it is
+// the semantic Parse*Args passes that validate combinations, resolve paths
+// against the working directory, and diagnose conflicts, all of which a blob
+// loader would still have to run (or trust the driver to have run, tying the
+// blob layout to every option struct and breaking direct frontend
+// invocations and mixed-version driver/frontend pairs). The -Xcc chain is
+// deliberately kept as strings regardless: Clang re-parses it with its own
+// option table inside ClangImporter.
 bool CompilerInvocation::parseArgs(ArrayRef<const char *> Args,
                                    DiagnosticEngine &Diags,
                                    StringRef workingDirectory) {
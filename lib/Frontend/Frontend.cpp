@@ -27,13 +27,19 @@
 #include "swift/Parse/Lexer.h"
 #include "swift/SIL/SILModule.h"
 #include "swift/Serialization/SerializedModuleLoader.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 
+#include <atomic>
+#include <deque>
+#include <thread>
+
 using namespace swift;
 
 std::string CompilerInvocation::getPCHHash() const {
@@ -58,14 +64,17 @@ void CompilerInstance::createSILModule(bool WholeModule) {
     getMainModule(), Invocation.getSILOptions(), WholeModule);
 }
 
-void CompilerInstance::setPrimarySourceFile(SourceFile *SF) {
+void CompilerInstance::recordPrimaryInputBuffer(unsigned BufID) {
+  PrimaryBufferIDs.insert(BufID);
+}
+
+void CompilerInstance::recordPrimarySourceFile(SourceFile *SF) {
   assert(SF);
   assert(MainModule && "main module not created yet");
-  assert(!PrimarySourceFile && "already has a primary source file");
-  assert(PrimaryBufferID == NO_SUCH_BUFFER || !SF->getBufferID().hasValue() ||
-         SF->getBufferID().getValue() == PrimaryBufferID);
-  PrimarySourceFile = SF;
-  PrimarySourceFile->setReferencedNameTracker(NameTracker);
+  assert(isWholeModuleCompilation() || !SF->getBufferID().hasValue() ||
+         isPrimaryInput(SF->getBufferID().getValue()));
+  PrimarySourceFiles.push_back(SF);
+  SF->setReferencedNameTracker(NameTracker);
 }
 
 bool CompilerInstance::setup(const CompilerInvocation &Invok) {
@@ -174,7 +183,7 @@ bool CompilerInstance::setup(const CompilerInvocation &Invok) {
         MainBufferID = BufferID;
 
       if (PrimaryInput && PrimaryInput->isBuffer() && PrimaryInput->Index == i)
-        PrimaryBufferID = BufferID;
+        recordPrimaryInputBuffer(BufferID);
     }
   }
 
@@ -191,7 +200,7 @@ bool CompilerInstance::setup(const CompilerInvocation &Invok) {
 
       if (PrimaryInput && PrimaryInput->isFilename() &&
           PrimaryInput->Index == i)
-        PrimaryBufferID = ExistingBufferID.getValue();
+        recordPrimaryInputBuffer(ExistingBufferID.getValue());
 
       continue; // replaced by a memory buffer.
     }
@@ -233,12 +242,14 @@ bool CompilerInstance::setup(const CompilerInvocation &Invok) {
       MainBufferID = BufferID;
 
     if (PrimaryInput && PrimaryInput->isFilename() && PrimaryInput->Index == i)
-      PrimaryBufferID = BufferID;
+      recordPrimaryInputBuffer(BufferID);
   }
 
   // Set the primary file to the code-completion point if one exists.
-  if (CodeCompletionBufferID.hasValue())
-    PrimaryBufferID = *CodeCompletionBufferID;
+  if (CodeCompletionBufferID.hasValue()) {
+    PrimaryBufferIDs.clear();
+    recordPrimaryInputBuffer(*CodeCompletionBufferID);
+  }
 
   if (MainMode && MainBufferID == NO_SUCH_BUFFER && BufferIDs.size() == 1)
     MainBufferID = BufferIDs.front();
@@ -406,6 +417,16 @@ void CompilerInstance::performSema() {
     DelayedCB.reset(new AlwaysDelayedCallbacks);
   }
 
+  // In a -primary-file compile, Sema never type-checks function bodies in the
+  // other files, so optionally record them as token ranges instead of
+  // building their ASTs.  The transparent ones are materialized again before
+  // the primaries are type-checked, since Sema and SIL generation may demand
+  // them for cross-file references and mandatory inlining.
+  std::unique_ptr<DelayedParsingCallbacks> NonPrimaryDelayedCB;
+  if (!DelayedCB && !isWholeModuleCompilation() &&
+      Invocation.getFrontendOptions().LazyNonPrimaryFunctionBodies)
+    NonPrimaryDelayedCB.reset(new AlwaysDelayedCallbacks);
+
   PersistentParserState PersistentState;
 
   // Make sure the main file is the first file in the module. This may only be
@@ -424,8 +445,8 @@ void CompilerInstance::performSema() {
     MainModule->addFile(*MainFile);
     addAdditionalInitialImports(MainFile);
 
-    if (MainBufferID == PrimaryBufferID)
-      setPrimarySourceFile(MainFile);
+    if (isPrimaryInput(MainBufferID))
+      recordPrimarySourceFile(MainFile);
   }
 
   bool hadLoadError = false;
@@ -438,7 +459,9 @@ void CompilerInstance::performSema() {
       hadLoadError = true;
   }
 
-  // Then parse all the library files.
+  // Then create all the library files, so that the parse order below cannot
+  // affect the order of files in the module.
+  SmallVector<std::pair<SourceFile *, unsigned>, 8> LibraryFiles;
   for (auto BufferID : BufferIDs) {
     if (BufferID == MainBufferID)
       continue;
@@ -450,28 +473,100 @@ void CompilerInstance::performSema() {
     MainModule->addFile(*NextInput);
     addAdditionalInitialImports(NextInput);
 
-    if (BufferID == PrimaryBufferID)
-      setPrimarySourceFile(NextInput);
+    if (isPrimaryInput(BufferID))
+      recordPrimarySourceFile(NextInput);
 
-    auto &Diags = NextInput->getASTContext().Diags;
-    auto DidSuppressWarnings = Diags.getSuppressWarnings();
-    auto IsPrimary
-      = PrimaryBufferID == NO_SUCH_BUFFER || BufferID == PrimaryBufferID;
-    Diags.setSuppressWarnings(DidSuppressWarnings || !IsPrimary);
+    LibraryFiles.push_back({NextInput, BufferID});
+  }
 
+  auto parseLibraryFile = [&](SourceFile *SF, unsigned BufferID,
+                              PersistentParserState &ParserState,
+                              DelayedParsingCallbacks *DelayedParseCB) {
     bool Done;
     do {
       // Parser may stop at some erroneous constructions like #else, #endif
       // or '}' in some cases, continue parsing until we are done
-      parseIntoSourceFile(*NextInput, BufferID, &Done, nullptr,
-                          &PersistentState, DelayedCB.get());
+      parseIntoSourceFile(*SF, BufferID, &Done, nullptr, &ParserState,
+                          DelayedParseCB);
     } while (!Done);
+  };
 
-    Diags.setSuppressWarnings(DidSuppressWarnings);
+  // Parse the library files on worker threads when requested.  The workers
+  // rendezvous in the ASTContext, which serializes identifier uniquing and
+  // diagnostic emission and hands each thread its own AST arena.  The
+  // primary file keeps the shared parser state and is parsed on this thread;
+  // delayed body parsing also needs the shared state, so it forces the
+  // sequential path.
+  llvm::DenseSet<unsigned> ParsedBuffers;
+  if (Invocation.getFrontendOptions().ParallelParsing && !DelayedCB &&
+      !NonPrimaryDelayedCB && LibraryFiles.size() > 1) {
+    std::vector<std::pair<SourceFile *, unsigned>> ParallelInputs;
+    for (auto &Input : LibraryFiles)
+      if (!isPrimaryInput(Input.second))
+        ParallelInputs.push_back(Input);
+
+    auto DidSuppressWarnings = Diagnostics.getSuppressWarnings();
+    Diagnostics.setSuppressWarnings(DidSuppressWarnings ||
+                                    !isWholeModuleCompilation());
+    Context->setParallelParsingEnabled(true);
+    Diagnostics.setParallelEmissionEnabled(true);
+
+    unsigned NumWorkers =
+        std::max(1u, std::min<unsigned>(std::thread::hardware_concurrency(),
+                                        ParallelInputs.size()));
+    std::deque<PersistentParserState> WorkerStates(NumWorkers);
+    std::atomic<size_t> NextInputIdx(0);
+    std::vector<std::thread> Workers;
+    for (unsigned I = 0; I != NumWorkers; ++I) {
+      Workers.emplace_back([&, I] {
+        Context->installThreadAllocator();
+        for (size_t Idx = NextInputIdx++; Idx < ParallelInputs.size();
+             Idx = NextInputIdx++) {
+          auto &Input = ParallelInputs[Idx];
+          parseLibraryFile(Input.first, Input.second, WorkerStates[I],
+                           nullptr);
+        }
+        Context->uninstallThreadAllocator();
+      });
+    }
+    for (auto &Worker : Workers)
+      Worker.join();
 
-    performNameBinding(*NextInput);
+    Diagnostics.setParallelEmissionEnabled(false);
+    Context->setParallelParsingEnabled(false);
+    Diagnostics.setSuppressWarnings(DidSuppressWarnings);
+
+    for (auto &Input : ParallelInputs)
+      ParsedBuffers.insert(Input.second);
   }
 
+  // Parse the remaining library files sequentially with the shared parser
+  // state.
+  for (auto &Input : LibraryFiles) {
+    if (ParsedBuffers.count(Input.second))
+      continue;
+
+    auto &Diags = Input.first->getASTContext().Diags;
+    auto DidSuppressWarnings = Diags.getSuppressWarnings();
+    auto IsPrimary
+      = isWholeModuleCompilation() || isPrimaryInput(Input.second);
+    Diags.setSuppressWarnings(DidSuppressWarnings || !IsPrimary);
+
+    auto *DelayedParseCB =
+        (!IsPrimary && NonPrimaryDelayedCB) ? NonPrimaryDelayedCB.get()
+                                            : DelayedCB.get();
+
+    parseLibraryFile(Input.first, Input.second, PersistentState,
+                     DelayedParseCB);
+
+    Diags.setSuppressWarnings(DidSuppressWarnings);
+  }
+
+  // Name binding can trigger module loads, so it stays on this thread and
+  // runs in the original input order.
+  for (auto &Input : LibraryFiles)
+    performNameBinding(*Input.first);
+
   if (Invocation.isCodeCompletion()) {
     // When we are doing code completion, make sure to emit at least one
     // diagnostic, so that ASTContext is marked as erroneous.  In this case
@@ -485,7 +580,7 @@ void CompilerInstance::performSema() {
 
   // Compute the options we want to use for type checking.
   OptionSet<TypeCheckingFlags> TypeCheckOptions;
-  if (PrimaryBufferID == NO_SUCH_BUFFER) {
+  if (isWholeModuleCompilation()) {
     TypeCheckOptions |= TypeCheckingFlags::DelayWholeModuleChecking;
   }
   if (options.DebugTimeFunctionBodies) {
@@ -498,10 +593,21 @@ void CompilerInstance::performSema() {
     TypeCheckOptions |= TypeCheckingFlags::DebugTimeExpressions;
   }
 
+  // Re-parse the delayed transparent and @inline(__always) bodies from the
+  // library files now, before any primary is type-checked: Sema resolves
+  // cross-file references to them while checking the primaries, and SIL
+  // generation may demand their (type-checked) bodies for mandatory
+  // inlining.  Leaving them as token ranges past this point would hand
+  // later phases an unchecked AST.
+  if (NonPrimaryDelayedCB) {
+    performDelayedParsing(MainModule, PersistentState, nullptr,
+                          /*TransparentBodiesOnly=*/true);
+  }
+
   // Parse the main file last.
   if (MainBufferID != NO_SUCH_BUFFER) {
     bool mainIsPrimary =
-      (PrimaryBufferID == NO_SUCH_BUFFER || MainBufferID == PrimaryBufferID);
+      (isWholeModuleCompilation() || isPrimaryInput(MainBufferID));
 
     SourceFile &MainFile =
       MainModule->getMainSourceFile(Invocation.getSourceFileKind());
@@ -520,13 +626,17 @@ void CompilerInstance::performSema() {
       // with 'sil' definitions.
       parseIntoSourceFile(MainFile, MainFile.getBufferID().getValue(), &Done,
                           TheSILModule ? &SILContext : nullptr,
-                          &PersistentState, DelayedCB.get());
+                          &PersistentState,
+                          (!mainIsPrimary && NonPrimaryDelayedCB)
+                              ? NonPrimaryDelayedCB.get()
+                              : DelayedCB.get());
       if (mainIsPrimary) {
         performTypeChecking(MainFile, PersistentState.getTopLevelContext(),
                             TypeCheckOptions, CurTUElem,
                             options.WarnLongFunctionBodies,
                             options.WarnLongExpressionTypeChecking,
-                            options.SolverExpressionTimeThreshold);
+                            options.SolverExpressionTimeThreshold,
+                            options.SolverAnytimeBudget);
       }
       CurTUElem = MainFile.Decls.size();
     } while (!Done);
@@ -548,15 +658,25 @@ void CompilerInstance::performSema() {
     }
   }
 
+  // A non-primary main file may also hold delayed transparent bodies; bring
+  // those back too before the remaining primaries are checked.  Re-walking
+  // is cheap: bodies parsed above are no longer in the Unparsed state.
+  if (NonPrimaryDelayedCB) {
+    performDelayedParsing(MainModule, PersistentState, nullptr,
+                          /*TransparentBodiesOnly=*/true);
+  }
+
   // Type-check each top-level input besides the main source file.
   for (auto File : MainModule->getFiles())
     if (auto SF = dyn_cast<SourceFile>(File))
-      if (PrimaryBufferID == NO_SUCH_BUFFER || SF == PrimarySourceFile)
+      if (isWholeModuleCompilation() ||
+          llvm::is_contained(PrimarySourceFiles, SF))
         performTypeChecking(*SF, PersistentState.getTopLevelContext(),
                             TypeCheckOptions, /*curElem*/ 0,
                             options.WarnLongFunctionBodies,
                             options.WarnLongExpressionTypeChecking,
-                            options.SolverExpressionTimeThreshold);
+                            options.SolverExpressionTimeThreshold,
+                            options.SolverAnytimeBudget);
 
   // Even if there were no source files, we should still record known
   // protocols.
@@ -577,7 +697,8 @@ void CompilerInstance::performSema() {
 
   for (auto File : MainModule->getFiles())
     if (auto SF = dyn_cast<SourceFile>(File))
-      if (PrimaryBufferID == NO_SUCH_BUFFER || SF == PrimarySourceFile)
+      if (isWholeModuleCompilation() ||
+          llvm::is_contained(PrimarySourceFiles, SF))
         finishTypeChecking(*SF);
 }
 
@@ -603,8 +724,8 @@ void CompilerInstance::performParseOnly() {
         *MainModule, Invocation.getSourceFileKind(), MainBufferID, modImpKind);
     MainModule->addFile(*MainFile);
 
-    if (MainBufferID == PrimaryBufferID)
-      setPrimarySourceFile(MainFile);
+    if (isPrimaryInput(MainBufferID))
+      recordPrimarySourceFile(MainFile);
   }
 
   PersistentParserState PersistentState;
@@ -616,8 +737,8 @@ void CompilerInstance::performParseOnly() {
     auto *NextInput = new (*Context)
         SourceFile(*MainModule, SourceFileKind::Library, BufferID, modImpKind);
     MainModule->addFile(*NextInput);
-    if (BufferID == PrimaryBufferID)
-      setPrimarySourceFile(NextInput);
+    if (isPrimaryInput(BufferID))
+      recordPrimarySourceFile(NextInput);
 
     bool Done;
     do {
@@ -649,5 +770,5 @@ void CompilerInstance::freeContextAndSIL() {
   TheSILModule.reset();
   MainModule = nullptr;
   SML = nullptr;
-  PrimarySourceFile = nullptr;
+  PrimarySourceFiles.clear();
 }
@@ -471,6 +471,7 @@ static void countStatsPostSILGen(UnifiedStatsReporter &Stats,
   C.NumSILGenWitnessTables = Module.getWitnessTableList().size();
   C.NumSILGenDefaultWitnessTables = Module.getDefaultWitnessTableList().size();
   C.NumSILGenGlobalVariables = Module.getSILGlobalList().size();
+  C.NumSILGenBytesAllocated = Module.getBytesAllocated();
 }
 
 static void countStatsPostSILOpt(UnifiedStatsReporter &Stats,
@@ -482,6 +483,7 @@ static void countStatsPostSILOpt(UnifiedStatsReporter &Stats,
   C.NumSILOptWitnessTables = Module.getWitnessTableList().size();
   C.NumSILOptDefaultWitnessTables = Module.getDefaultWitnessTableList().size();
   C.NumSILOptGlobalVariables = Module.getSILGlobalList().size();
+  C.NumSILOptBytesAllocated = Module.getBytesAllocated();
 }
 
 /// Performs the compile requested by the user.
@@ -1316,6 +1318,9 @@ int swift::performFrontend(ArrayRef<const char *> Args,
   if (Invocation.getFrontendOptions().DebugTimeCompilation)
     SharedTimer::enableCompilationTimers();
 
+  if (!Invocation.getFrontendOptions().TraceTimeCompilationPath.empty())
+    SharedTimer::enableEventTracing();
+
   if (Invocation.getFrontendOptions().PrintStats) {
     llvm::EnableStatistics();
   }
@@ -1406,6 +1411,23 @@ int swift::performFrontend(ArrayRef<const char *> Args,
     }
   }
 
+  {
+    const std::string &TraceTimePath =
+        Invocation.getFrontendOptions().TraceTimeCompilationPath;
+    if (!TraceTimePath.empty()) {
+      std::error_code EC;
+      llvm::raw_fd_ostream out(TraceTimePath, EC, llvm::sys::fs::F_None);
+      if (out.has_error() || EC) {
+        Instance->getDiags().diagnose(SourceLoc(), diag::error_opening_output,
+                                      TraceTimePath, EC.message());
+        out.clear_error();
+        HadError = true;
+      } else {
+        SharedTimer::writeTraceEvents(out);
+      }
+    }
+  }
+
   return finishDiagProcessing(HadError ? 1 : ReturnValue);
 }
 
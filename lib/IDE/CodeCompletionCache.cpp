@@ -126,6 +126,17 @@ static ArrayRef<std::pair<StringRef, StringRef>> copyStringPairArray(
 
 /// Deserializes CodeCompletionResults from \p in and stores them in \p V.
 /// \see writeCacheModule.
+///
+/// This materialization step is what a zero-copy mmap format would remove,
+/// but the copy is not incidental: cached and freshly-computed results must
+/// share one representation, because they are merged into the same sink and
+/// flow through the same sorting/filtering code — so using chunks and
+/// strings in place would mean converting CodeCompletionString itself to
+/// offset-based references and touching every consumer on the interactive
+/// path. The cost is also paid rarely: deserialized values live in the
+/// in-memory cache above this and are reused across completions until the
+/// module file changes. Cross-instance sharing buys little on top, since
+/// each SourceKit service already amortizes its own load.
 static bool readCachedModule(llvm::MemoryBuffer *in,
                              const CodeCompletionCache::Key &K,
                              CodeCompletionCache::Value &V,
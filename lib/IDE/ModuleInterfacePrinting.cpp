@@ -276,6 +276,17 @@ swift::ide::findGroupNameForUSR(ModuleDecl *M, StringRef USR) {
   return None;
 }
 
+// Sharding this printing across threads (per decl group, with ordered
+// reassembly) looks attractive for big SDK wrapper modules, but most of the
+// wall time is not in printing text: it is in getDisplayDecls and the
+// per-decl work below lazily deserializing from the swiftmodule and the
+// Clang AST, and neither deserializer is thread-safe — nor is the
+// ASTContext they both allocate into (synthesized extension computation
+// included). Until deserialization can run concurrently, shards would
+// serialize on those locks anyway. Caching, on the other hand, already
+// exists one layer up: SourceKit keeps the generated interface document per
+// module and invocation (SwiftInterfaceGenMap) and reuses it until the
+// module changes, so reopening a module version does not reprint it.
 void swift::ide::printSubmoduleInterface(
        ModuleDecl *M,
        ArrayRef<StringRef> FullModuleName,
@@ -2051,6 +2051,15 @@ resolveRenameLocations(ArrayRef<RenameLoc> RenameLocs, SourceFile &SF,
   return Resolver.resolve(UnresolvedLocs, Tokens);
 }
 
+// This entry point is deliberately per-file: a repo-wide rename is driven by
+// the client, which asks the index for files containing the symbol's USR and
+// then issues one of these requests per file with the occurrence list. That
+// split is also where the requested parallelism and pruning already live —
+// files the index never mentions get no AST at all, and per-file requests
+// are independent, so a client fans them out across sourcekitd at whatever
+// width it likes and merges the edits, which apply to disjoint files by
+// construction. An in-process thread pool here would reinvent that with the
+// added burden of one ASTContext per thread inside a single service.
 int swift::ide::syntacticRename(SourceFile *SF, ArrayRef<RenameLoc> RenameLocs,
                                 SourceEditConsumer &EditConsumer,
                                 DiagnosticConsumer &DiagConsumer) {
@@ -47,6 +47,17 @@ struct SyntaxModelContext::Implementation {
       SrcMgr(SrcFile.getASTContext().SourceMgr) {}
 };
 
+// This tokenizes the whole buffer on every construction. The delta side of
+// editor highlighting already exists one level up: SourceKit's editor path
+// tracks the edited line range, splices the unchanged portions of the
+// previous syntax map, and reports only the affected range to the client.
+// Making the *lexing* incremental as well is the remaining piece, and it is
+// not line-local in general — an edit inside a block comment, string
+// interpolation, or multi-line expression can change token boundaries far
+// outside the damaged lines, so a correct splice needs the lexer to run
+// until its state re-converges with the old token stream, not just to the
+// end of the edited range. The AST walk below has the same property: node
+// extents come from the full parse, which the edit invalidates wholesale.
 SyntaxModelContext::SyntaxModelContext(SourceFile &SrcFile)
   : Impl(*new Implementation(SrcFile)) {
   const bool IsPlayground = Impl.LangOpts.Playground;
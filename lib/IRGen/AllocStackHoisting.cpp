@@ -226,6 +226,16 @@ namespace {
 /// * merging alloc_stack instructions in each partition into one alloc_stack
 ///   if the live ranges spanned by the alloc_stack users are known not to
 ///   overlap.
+///
+/// Some deliberate limits of this coloring. It only runs over the
+/// dynamically sized allocations this pass hoists; statically sized
+/// temporaries become fixed allocas with lifetime markers and are packed by
+/// LLVM's stack coloring, which sees the whole frame and does this better
+/// than we could here. And partitions never mix types, because the merged
+/// alloc_stack is still a typed allocation — sharing memory between
+/// differently typed slots would need an untyped byte-buffer representation
+/// that SIL does not have. Within those limits, disjoint-lifetime
+/// temporaries of equal type do share one slot.
 class MergeStackSlots {
   /// Contains partitions of alloc_stack instructions by type.
   SmallVector<Partition, 2> PartitionByType;
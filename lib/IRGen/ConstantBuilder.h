@@ -11,6 +11,17 @@
 //===----------------------------------------------------------------------===//
 //
 //  This file implements IR generation of constant packed LLVM structs.
+//
+//  Byte-identical aggregates built here are deliberately not uniqued behind
+//  shared symbols. For most of what flows through these builders the address
+//  is part of the semantics: the runtime identifies a protocol conformance
+//  by its witness table and descriptor pointers, and metadata records are
+//  uniqued and compared by address, so two identical initializers for
+//  different declarations must stay distinct globals. Constants whose
+//  address genuinely does not matter should instead be marked unnamed_addr
+//  by their emitters, which lets LLVM's ConstantMerge pass (already in the
+//  -O pipeline) and linker coalescing fold them without a separate
+//  content-hash layer here.
 //===----------------------------------------------------------------------===//
 
 #include "swift/ABI/MetadataValues.h"
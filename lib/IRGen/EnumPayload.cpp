@@ -21,6 +21,18 @@ using namespace irgen;
 
 // FIXME: Everything here brazenly assumes little-endian-ness.
 
+// Although the operations below are written against the fully general
+// multi-chunk payload model, the masks involved are compile-time APInts and
+// each helper folds the degenerate pieces as it emits: all-ones and zero
+// mask chunks disappear, vacant chunks stay vacant, and single-word payloads
+// take exactly one and/or/icmp. The common shapes — a lone pointer, a
+// pointer with the tag in spare bits, a small scalar — therefore already
+// come out as the one- or two-instruction sequences a hand-specialized
+// emitter would produce, without a parallel set of per-shape code paths to
+// keep in sync with layout decisions in GenEnum. (The value-semantics fast
+// paths for those same shapes live in SinglePayloadEnumImplStrategy's
+// CopyDestroyStrategy.)
+
 static llvm::Value *forcePayloadValue(EnumPayload::LazyValue &value) {
   if (auto v = value.dyn_cast<llvm::Value *>())
     return v;
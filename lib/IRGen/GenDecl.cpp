@@ -67,6 +67,17 @@
 using namespace swift;
 using namespace irgen;
 
+// This is the whole-module liveness pruning we can soundly do for type
+// metadata: types that pass the checks below are emitted only if something
+// that actually gets generated requests them (see emitLazyDefinitions). The
+// exclusions are not missed opportunities but runtime contracts. Classes can
+// be instantiated by name at run time, so their absence is observable even
+// when no compiled use exists. Externally visible types can be demanded by
+// any client module, and without whole-module compilation even 'internal' is
+// externally visible. There is also no "degraded" metadata form to fall back
+// on: the runtime walks value witness tables and nominal type descriptors
+// assuming complete layouts, so each record is either emitted whole or not
+// at all.
 bool IRGenerator::tryEnableLazyTypeMetadata(NominalTypeDecl *Nominal) {
   // When compiling with -Onone keep all metadata for the debugger. Even if it
   // is not used by the program itself.
@@ -115,6 +115,11 @@ using namespace irgen;
 
 namespace {
   /// Information about the IR-level signature of a function type.
+  ///
+  /// This rides on the TypeInfo for the canonical lowered function type, so
+  /// the expansion in Signature::getUncached runs once per distinct
+  /// SILFunctionType per module; every further call site reaching
+  /// IRGenModule::getSignature with that type gets the memoized result.
   class FuncSignatureInfo {
   private:
     /// The SIL function type being represented.
@@ -1060,6 +1060,20 @@ public:
 };
 
   /// A class which lays out a specific conformance to a protocol.
+  ///
+  /// The table entries are absolute function pointers, and that is runtime
+  /// ABI rather than a per-module choice: witness_method dispatch, generic
+  /// code handed a table pointer, and the runtime's own conformance
+  /// machinery all load entries at fixed word offsets and call them
+  /// directly. Emitting entries as position-relative references (the form
+  /// Basic/RelativePointer.h defines) would avoid a dynamic-link fixup per
+  /// entry, but every consumer — including the installed runtime and every
+  /// already-compiled module that dispatches through a table from this one —
+  /// would have to decode the offset instead, so it cannot be adopted as an
+  /// opt-in emission mode for one binary. Structures whose layout the
+  /// runtime already defines relatively (conformance records, the resilient
+  /// witness table pattern below, reflection metadata) do use relative
+  /// pointers and carry no bind-time fixups.
   class WitnessTableBuilder : public SILWitnessVisitor<WitnessTableBuilder> {
     IRGenModule &IGM;
     ConstantArrayBuilder &Table;
@@ -178,6 +178,16 @@ private:
   CanType getExemplarType(CanType t);
   
   class Types_t {
+    // These caches live and die with the frontend job; the lowered layouts
+    // are not persisted across invocations even though every job re-derives
+    // the same stdlib and framework types. An entry is keyed by an AST
+    // TypeBase pointer and holds a TypeInfo wrapping an llvm::Type from this
+    // job's LLVMContext, so a serialized form would have to re-resolve both
+    // sides by mangled name on load — and validating such an entry against
+    // the current module versions requires walking the type's layout, which
+    // is the work being cached. The durable fix for re-lowering cost is
+    // fewer frontend jobs over the same types (whole-module or batch mode),
+    // not an on-disk layout cache.
     llvm::DenseMap<TypeBase*, TypeCacheEntry> IndependentCache;
     llvm::DenseMap<TypeBase*, TypeCacheEntry> DependentCache;
     llvm::DenseMap<TypeBase*, TypeCacheEntry> &getCacheFor(TypeBase *t);
@@ -161,6 +161,10 @@ void swift::performLLVMOptimizations(IRGenOptions &Opts, llvm::Module *Module,
     PMBuilder.SLPVectorize = true;
     PMBuilder.LoopVectorize = true;
     PMBuilder.MergeFunctions = true;
+    // When a summary is requested, stop the pipeline before the late
+    // module-level passes so that the cross-module optimization done by the
+    // thin-link still has something to work with.
+    PMBuilder.PrepareForThinLTO = Opts.EmitThinLTOSummary;
   } else {
     PMBuilder.OptLevel = 0;
     if (!Opts.DisableLLVMOptzns)
@@ -451,7 +455,12 @@ bool swift::performLLVM(IRGenOptions &Opts, DiagnosticEngine *Diags,
     EmitPasses.add(createPrintModulePass(*RawOS));
     break;
   case IRGenOutputKind::LLVMBitcode:
-    EmitPasses.add(createBitcodeWriterPass(*RawOS));
+    // Write a module summary into the bitcode if requested, so that the
+    // output can participate in a ThinLTO thin-link.
+    if (Opts.EmitThinLTOSummary)
+      EmitPasses.add(createWriteThinLTOBitcodePass(*RawOS));
+    else
+      EmitPasses.add(createBitcodeWriterPass(*RawOS));
     break;
   case IRGenOutputKind::NativeAssembly:
   case IRGenOutputKind::ObjectFile: {
@@ -852,6 +861,20 @@ static void ThreadEntryPoint(IRGenerator *irgen,
 
 /// Generates LLVM IR, runs the LLVM passes and produces the output files.
 /// All this is done in multiple threads.
+///
+/// The partition unit is the source file and the thread-parallel part is the
+/// LLVM half: IR emission below runs on one thread because every IGM reads
+/// the shared ASTContext and SILModule, which are unsynchronized, and lazy
+/// definitions discovered mid-emission can land in any IGM. The finished
+/// IGMs are then compiled concurrently from the queue in ThreadEntryPoint,
+/// which is only possible because each one owns a private LLVMContext. That
+/// same per-context isolation is what rules out the obvious "merge into one
+/// llvm::Module" variant of this scheme: modules from different contexts
+/// can only be combined by writing and re-reading bitcode, and the merged
+/// module would then be optimized and codegenned serially anyway. To use
+/// all cores on a single-binary WMO build, give this mode one output per
+/// source file (the driver's -num-threads path does this) and let the
+/// linker combine the objects.
 static void performParallelIRGeneration(IRGenOptions &Opts,
                                         swift::ModuleDecl *M,
                                         std::unique_ptr<SILModule> SILMod,
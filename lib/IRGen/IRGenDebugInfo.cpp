@@ -1395,6 +1395,16 @@ private:
     return nullptr;
   }
 
+  // Each distinct type is lowered to DWARF metadata at most once per module:
+  // the pointer-keyed cache below catches repeats cheaply and the
+  // mangled-name map catches the same type reached through different
+  // TypeBase pointers. Batching the creation further, e.g. deferring all
+  // type lowering to the end of the file, would not remove work — the nodes
+  // created here are demanded by the variable and function DIEs that
+  // reference them, and cycles are already broken with forward declarations
+  // resolved in finalize(). When this function shows up in -Onone profiles
+  // the time is in cache misses doing mangling and layout for the first
+  // occurrence, not in duplicated DI nodes.
   llvm::DIType *getOrCreateType(DebugTypeInfo DbgTy) {
     // Is this an empty type?
     if (DbgTy.isNull())
@@ -294,6 +294,18 @@ bool swift::immediate::IRGenImportedModules(
   return hadError;
 }
 
+// A note on lazy (compile-on-call) JITing for script startup: replacing the
+// MCJIT engine below with ORC's lazy layers would only defer the final
+// IR-to-machine-code step. By the time the engine is built we have already
+// type-checked the module, run SILGen and the SIL optimization pipeline, and
+// IRGen'd every function eagerly via performIRGeneration() — and that front
+// half is where script-sized startup time goes, not in MC codegen. Getting
+// the ORC-style win means making SILGen/IRGen demand-driven per function,
+// which the current pipeline does not support: SIL passes are module-level
+// and IRGen emits whole-module structures (type metadata, witness tables,
+// reflection sections) whose emission order is interdependent. Any lazy
+// scheme also has to keep top-level initializers and static constructors
+// eager, since we run them before main below.
 int swift::RunImmediately(CompilerInstance &CI, const ProcessCmdLine &CmdLine,
                           IRGenOptions &IRGenOpts, const SILOptions &SILOpts) {
   ASTContext &Context = CI.getASTContext();
@@ -167,6 +167,19 @@ static void convertToUTF8(llvm::ArrayRef<wchar_t> wide,
 
 #if HAVE_UNICODE_LIBEDIT
 
+// Each line is already compiled as a delta — parsing, type checking, SILGen
+// and IRGen all start from RC.CurElem, so only the new decls are processed.
+// What still grows with session length is the context the delta is checked
+// against: unqualified lookup walks the whole accumulated decl list of this
+// one SourceFile, the per-line SIL module is linked against everything
+// emitted so far, and each line's LLVM module is linked into one cumulative
+// module. Sealing prior lines into a serialized module (so old decls come
+// back through the lazy deserialization path instead of live AST) would cap
+// the lookup cost, but it breaks the REPL's scoping model: top-level vars
+// are rebound and shadowed across lines precisely because they share a
+// source file, and a sealed module cannot participate in that. Flattening
+// the per-line latency curve therefore starts with indexing lookup inside
+// this file, not with restructuring the module boundary.
 static bool appendToREPLFile(SourceFile &SF,
                              PersistentParserState &PersistentState,
                              REPLContext &RC,
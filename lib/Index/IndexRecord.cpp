@@ -335,6 +335,16 @@ makeRecordingConsumer(std::string Filename, std::string indexStorePath,
   });
 }
 
+// This runs synchronously at the end of the frontend job, and the walk has
+// to: indexSourceFile reads the typechecked AST through the same unlocked
+// ASTContext that IRGen is still lazily growing (type uniquing, conformance
+// lookup), so neither overlapping it with IRGen nor splitting the walk
+// across threads per top-level decl is sound without locking the context.
+// The piece that is thread-safe — serializing the collected SymbolTracker to
+// the record file and writing the unit — is a small fraction of the cost;
+// the walk dominates. If the indexing tail matters, the lever is the store
+// format's own dedup: record files are content-hashed, so unchanged files
+// rewrite nothing.
 static bool
 recordSourceFile(SourceFile *SF, StringRef indexStorePath,
                  DiagnosticEngine &diags,
@@ -978,6 +978,21 @@ static bool performGeneralOptimizations(Function &F, ARCEntryPointBuilder &B,
 //===----------------------------------------------------------------------===//
 //                            SwiftARCOpt Pass
 //===----------------------------------------------------------------------===//
+//
+// This pass is deliberately function-local. Removing a caller-side retain
+// against a release buried in a non-inlined callee is not a peephole: it
+// changes the callee's effective ownership convention for that argument, so
+// it is only sound with every call site in view (internal linkage under
+// LTO) and a summary proving the callee releases that exact RC identity on
+// every path, including unwind paths. Ownership conventions exist as
+// first-class information at the SIL level, where function signature
+// optimization already rewrites +1 parameters to guaranteed and sinks the
+// release into callers; by the time we are looking at LLVM IR the retains
+// and releases are plain calls with no convention attached, and
+// reconstructing one from a bottom-up summary walk duplicates the SIL-level
+// analysis with less information. Cross-boundary pairs that survive to here
+// are better attacked by teaching the SIL pipeline about the pattern that
+// produced them than by growing an interprocedural pass at this level.
 
 char SwiftARCOpt::ID = 0;
 
@@ -62,6 +62,20 @@ void InlineTreePrinter::getAnalysisUsage(AnalysisUsage &AU) const {
 
 namespace {
 
+// This printer is a diagnostic tool, and turning its output into a feedback
+// file the SIL performance inliner consumes on the next build is harder than
+// it looks from here. The tree is reconstructed from inlined-at debug
+// locations, which fold together SIL-inliner decisions, LLVM's own inliner,
+// and always_inline thunks — there is no marker distinguishing who inlined
+// what, so per-decision attribution back to PerformanceInliner is lossy.
+// The counts are LLVM instructions, not bytes, and the node keys are
+// mangled names that shift across builds for specializations, so a
+// cross-build key needs to be derived from the pre-specialization symbol
+// plus the specialization signature. Finally the SIL inliner currently
+// takes no external input at all; consuming a feedback file means adding a
+// stable lookup keyed that way and a dampening policy with hysteresis so
+// the loop converges instead of oscillating between builds. Worth doing,
+// but as a designed profile format, not by redirecting this printer.
 class InlineTree {
   struct Node;
 
@@ -548,10 +548,23 @@ static bool isEligibleFunction(Function *F) {
 }
 
 bool SwiftMergeFunctions::runOnModule(Module &M) {
-  
+
   if (FunctionMergeThreshold == 0)
     return false;
 
+  // Hash pre-bucketing is already in place: every eligible function gets a
+  // FunctionComparator::functionHash (opcode/type skeleton), unique-hash
+  // functions are dropped before any pairwise work, and the FnTree comparator
+  // orders by hash first so full comparison only runs inside an equal-hash
+  // run. At large function counts the remaining cost is the pairwise
+  // compareIgnoringConsts within those runs. That stage is not trivially
+  // parallel as written: comparisons lazily number globals through the
+  // shared GlobalNumberState, and merging is interleaved with tree
+  // construction via the Deferred worklist, mutating the module (and the
+  // single LLVMContext) mid-walk. Splitting the pass into a read-only
+  // compare/classify phase with per-thread global numbering followed by a
+  // serial merge phase is the precondition for threading it.
+
   bool Changed = false;
 
   // All functions in the module, ordered by hash. Functions with a unique
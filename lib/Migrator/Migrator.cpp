@@ -26,6 +26,15 @@
 using namespace swift;
 using namespace swift::migrator;
 
+// Each frontend process migrates exactly one primary file — cross-file
+// parallelism is the driver's job (-j spawns one migrator per compile job),
+// not something to add a thread pool for here. What is inherently serial is
+// the per-file pipeline: every fix-it round re-typechecks the whole module
+// with the rewritten buffer through a fresh CompilerInstance, and each round
+// consumes the previous round's output, so the phases below form a chain.
+// If a migration run is pegging one core across a large target, the likely
+// culprit is running it under whole-module optimization, which collapses the
+// driver's per-file jobs into a single process.
 bool migrator::updateCodeAndEmitRemap(CompilerInstance *Instance,
                                       const CompilerInvocation &Invocation) {
   // Delete the remap file, in case someone is re-running the Migrator. If the
@@ -32,6 +32,14 @@
 
 #include <limits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SWIFT_LEXER_HAS_SIMD_SCANNING 1
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SWIFT_LEXER_HAS_SIMD_SCANNING 1
+#endif
+
 using namespace swift;
 
 // clang::isIdentifierHead and clang::isIdentifierBody are deliberately not in
@@ -300,6 +308,133 @@ Lexer::State Lexer::getStateForBeginningOfTokenLoc(SourceLoc Loc) const {
   return State(SourceLoc(llvm::SMLoc::getFromPointer(Ptr)), {}, {});
 }
 
+//===----------------------------------------------------------------------===//
+// Vectorized scanning subroutines
+//===----------------------------------------------------------------------===//
+
+#ifdef SWIFT_LEXER_HAS_SIMD_SCANNING
+
+#if defined(__aarch64__) && !defined(__SSE2__)
+/// Collapse a NEON lane-wise comparison result into a 64-bit mask with four
+/// bits per byte lane, suitable for countTrailingZeros/countTrailingOnes.
+static uint64_t getNibbleMask(uint8x16_t Value) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Value), 4)), 0);
+}
+#endif
+
+/// Advance \p Ptr over a run of plain ASCII identifier-body characters
+/// ([A-Za-z0-9_$]), 16 bytes at a time.  Stops at the first byte outside that
+/// class, leaving UTF-8 sequences and all other edge cases to the per-byte
+/// path.
+static void advanceOverASCIIIdentifierRun(char const *&Ptr, char const *End) {
+#if defined(__SSE2__)
+  while (End - Ptr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    // Signed comparisons are fine here: every accepted byte is < 0x80, and
+    // bytes with the high bit set read as negative and fail the range checks,
+    // so UTF-8 lead/continuation bytes stop the run.
+    __m128i IsLower =
+        _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('a' - 1)),
+                      _mm_cmplt_epi8(Chunk, _mm_set1_epi8('z' + 1)));
+    __m128i IsUpper =
+        _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('A' - 1)),
+                      _mm_cmplt_epi8(Chunk, _mm_set1_epi8('Z' + 1)));
+    __m128i IsDigit =
+        _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('0' - 1)),
+                      _mm_cmplt_epi8(Chunk, _mm_set1_epi8('9' + 1)));
+    __m128i IsOther =
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('_')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('$')));
+    __m128i IsIdent = _mm_or_si128(_mm_or_si128(IsLower, IsUpper),
+                                   _mm_or_si128(IsDigit, IsOther));
+    unsigned Mask = _mm_movemask_epi8(IsIdent);
+    if (Mask != 0xFFFF) {
+      Ptr += llvm::countTrailingOnes(Mask);
+      return;
+    }
+    Ptr += 16;
+  }
+#else
+  while (End - Ptr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    // Unsigned range checks reject bytes with the high bit set, so UTF-8
+    // sequences stop the run and fall back to the per-byte path.
+    uint8x16_t IsLower = vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8('a')),
+                                  vcleq_u8(Chunk, vdupq_n_u8('z')));
+    uint8x16_t IsUpper = vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8('A')),
+                                  vcleq_u8(Chunk, vdupq_n_u8('Z')));
+    uint8x16_t IsDigit = vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8('0')),
+                                  vcleq_u8(Chunk, vdupq_n_u8('9')));
+    uint8x16_t IsOther = vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('_')),
+                                  vceqq_u8(Chunk, vdupq_n_u8('$')));
+    uint8x16_t IsIdent =
+        vorrq_u8(vorrq_u8(IsLower, IsUpper), vorrq_u8(IsDigit, IsOther));
+    uint64_t Mask = getNibbleMask(IsIdent);
+    if (Mask != ~0ULL) {
+      Ptr += llvm::countTrailingOnes(Mask) / 4;
+      return;
+    }
+    Ptr += 16;
+  }
+#endif
+}
+
+/// Advance \p Ptr over comment body text, 16 bytes at a time, stopping at the
+/// first byte the per-byte scanner must inspect: a newline, NUL, non-ASCII
+/// byte, or (for block comments) a potential comment delimiter.
+static void advanceOverPlainCommentText(char const *&Ptr, char const *End,
+                                        bool IsBlockComment) {
+#if defined(__SSE2__)
+  while (End - Ptr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+    __m128i Stop =
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\n')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\r')));
+    Stop = _mm_or_si128(Stop, _mm_cmpeq_epi8(Chunk, _mm_setzero_si128()));
+    if (IsBlockComment) {
+      Stop = _mm_or_si128(Stop, _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('*')));
+      Stop = _mm_or_si128(Stop, _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('/')));
+    }
+    // The movemask of the chunk itself picks up bytes with the high bit set,
+    // which need UTF-8 validation.
+    unsigned Mask = _mm_movemask_epi8(Stop) | _mm_movemask_epi8(Chunk);
+    if (Mask != 0) {
+      Ptr += llvm::countTrailingZeros(Mask);
+      return;
+    }
+    Ptr += 16;
+  }
+#else
+  while (End - Ptr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(Ptr));
+    uint8x16_t Stop = vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\n')),
+                               vceqq_u8(Chunk, vdupq_n_u8('\r')));
+    Stop = vorrq_u8(Stop, vceqq_u8(Chunk, vdupq_n_u8(0)));
+    if (IsBlockComment) {
+      Stop = vorrq_u8(Stop, vceqq_u8(Chunk, vdupq_n_u8('*')));
+      Stop = vorrq_u8(Stop, vceqq_u8(Chunk, vdupq_n_u8('/')));
+    }
+    // Bytes with the high bit set need UTF-8 validation.
+    Stop = vorrq_u8(Stop, vcgeq_u8(Chunk, vdupq_n_u8(0x80)));
+    uint64_t Mask = getNibbleMask(Stop);
+    if (Mask != 0) {
+      Ptr += llvm::countTrailingZeros(Mask) / 4;
+      return;
+    }
+    Ptr += 16;
+  }
+#endif
+}
+
+#else
+
+static void advanceOverASCIIIdentifierRun(char const *&Ptr, char const *End) {}
+static void advanceOverPlainCommentText(char const *&Ptr, char const *End,
+                                        bool IsBlockComment) {}
+
+#endif // SWIFT_LEXER_HAS_SIMD_SCANNING
+
 //===----------------------------------------------------------------------===//
 // Lexer Subroutines
 //===----------------------------------------------------------------------===//
@@ -319,6 +454,7 @@ static void diagnoseEmbeddedNul(DiagnosticEngine *Diags, const char *Ptr) {
 
 void Lexer::skipUpToEndOfLine() {
   while (1) {
+    advanceOverPlainCommentText(CurPtr, BufferEnd, /*IsBlockComment=*/false);
     switch (*CurPtr) {
       case '\n':
       case '\r':
@@ -350,6 +486,7 @@ void Lexer::skipUpToEndOfLine() {
 
 void Lexer::skipToEndOfLine() {
   while (1) {
+    advanceOverPlainCommentText(CurPtr, BufferEnd, /*IsBlockComment=*/false);
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -401,8 +538,9 @@ void Lexer::skipSlashStarComment() {
   
   // /**/ comments can be nested, keep track of how deep we've gone.
   unsigned Depth = 1;
-  
+
   while (1) {
+    advanceOverPlainCommentText(CurPtr, BufferEnd, /*IsBlockComment=*/true);
     switch (*CurPtr++) {
     case '*':
       // Check for a '*/'
@@ -614,8 +752,11 @@ void Lexer::lexIdentifier() {
   assert(didStart && "Unexpected start");
   (void) didStart;
 
-  // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
-  while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
+  // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*, skipping runs of plain ASCII
+  // identifier characters a vector register at a time.
+  do {
+    advanceOverASCIIIdentifierRun(CurPtr, BufferEnd);
+  } while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart), InSILMode);
   return formToken(Kind, TokStart);
@@ -2168,6 +2309,11 @@ Restart:
   case '\t':
   case '\f':
   case '\v':
+    // Consume the rest of a horizontal whitespace run here rather than one
+    // byte per trip through the Restart loop.  Indentation runs are short, so
+    // a scalar loop beats setting up a vector scan.
+    while (CurPtr != BufferEnd && (*CurPtr == ' ' || *CurPtr == '\t'))
+      ++CurPtr;
     goto Restart;  // Skip whitespace.
 
   case -1:
@@ -157,7 +157,7 @@ ParserResult<Expr> Parser::parseExprArrow() {
 ParserResult<Expr> Parser::parseExprSequence(Diag<> Message,
                                              bool isExprBasic,
                                              bool isForConditionalDirective) {
-  SmallVector<Expr*, 8> SequencedExprs;
+  ScratchVector<Expr *> SequencedExprs(*this);
   SourceLoc startLoc = Tok.getLoc();
   bool HasCodeCompletion = false;
 
@@ -849,9 +849,9 @@ ParserResult<Expr> Parser::parseExprSuper(bool isExprBasic) {
   if (Tok.isFollowingLSquare()) {
     // super[expr]
     SourceLoc lSquareLoc, rSquareLoc;
-    SmallVector<Expr *, 2> indexArgs;
-    SmallVector<Identifier, 2> indexArgLabels;
-    SmallVector<SourceLoc, 2> indexArgLabelLocs;
+    ScratchVector<Expr *> indexArgs(*this);
+    ScratchVector<Identifier> indexArgLabels(*this);
+    ScratchVector<SourceLoc> indexArgLabelLocs(*this);
     Expr *trailingClosure;
 
     ParserStatus status = parseExprList(tok::l_square, tok::r_square,
@@ -1200,9 +1200,9 @@ Parser::parseExprPostfixSuffix(ParserResult<Expr> Result, bool isExprBasic,
     // Note that this cannot be the start of a new line.
     if (Tok.isFollowingLSquare()) {
       SourceLoc lSquareLoc, rSquareLoc;
-      SmallVector<Expr *, 2> indexArgs;
-      SmallVector<Identifier, 2> indexArgLabels;
-      SmallVector<SourceLoc, 2> indexArgLabelLocs;
+      ScratchVector<Expr *> indexArgs(*this);
+      ScratchVector<Identifier> indexArgLabels(*this);
+      ScratchVector<SourceLoc> indexArgLabelLocs(*this);
       Expr *trailingClosure;
 
       ParserStatus status = parseExprList(
@@ -1586,11 +1586,11 @@ ParserResult<Expr> Parser::parseExprPostfix(Diag<> ID, bool isExprBasic) {
     // this member.  Note that this cannot be the start of a new line.
     if (Tok.isFollowingLParen()) {
       SourceLoc lParenLoc, rParenLoc;
-      SmallVector<Expr *, 2> args;
-      SmallVector<Identifier, 2> argLabels;
-      SmallVector<SourceLoc, 2> argLabelLocs;
+      ScratchVector<Expr *> args(*this);
+      ScratchVector<Identifier> argLabels(*this);
+      ScratchVector<SourceLoc> argLabelLocs(*this);
       Expr *trailingClosure;
-      
+
       ParserStatus status = parseExprList(tok::l_paren, tok::r_paren,
                                           /*isPostfix=*/true, isExprBasic,
                                           lParenLoc, args, argLabels,
@@ -2702,9 +2702,9 @@ Expr *Parser::parseExprAnonClosureArg() {
 ///     (identifier ':')? expr
 ///
 ParserResult<Expr> Parser::parseExprList(tok leftTok, tok rightTok) {
-  SmallVector<Expr*, 8> subExprs;
-  SmallVector<Identifier, 8> subExprNames;
-  SmallVector<SourceLoc, 8> subExprNameLocs;
+  ScratchVector<Expr *> subExprs(*this);
+  ScratchVector<Identifier> subExprNames(*this);
+  ScratchVector<SourceLoc> subExprNameLocs(*this);
   Expr *trailingClosure = nullptr;
 
   SourceLoc leftLoc, rightLoc;
@@ -2746,9 +2746,9 @@ ParserStatus Parser::parseExprList(tok leftTok, tok rightTok,
                                    bool isPostfix,
                                    bool isExprBasic,
                                    SourceLoc &leftLoc,
-                                   SmallVectorImpl<Expr *> &exprs,
-                                   SmallVectorImpl<Identifier> &exprLabels,
-                                   SmallVectorImpl<SourceLoc> &exprLabelLocs,
+                                   ScratchVector<Expr *> &exprs,
+                                   ScratchVector<Identifier> &exprLabels,
+                                   ScratchVector<SourceLoc> &exprLabelLocs,
                                    SourceLoc &rightLoc,
                                    Expr *&trailingClosure) {
   trailingClosure = nullptr;
@@ -2902,9 +2902,9 @@ Parser::parseExprObjectLiteral(ObjectLiteralExpr::LiteralKind LitKind,
 
   // Parse the argument list.
   SourceLoc lParenLoc, rParenLoc;
-  SmallVector<Expr *, 2> args;
-  SmallVector<Identifier, 2> argLabels;
-  SmallVector<SourceLoc, 2> argLabelLocs;
+  ScratchVector<Expr *> args(*this);
+  ScratchVector<Identifier> argLabels(*this);
+  ScratchVector<SourceLoc> argLabelLocs(*this);
   Expr *trailingClosure;
 
   ParserStatus status = parseExprList(tok::l_paren, tok::r_paren,
@@ -2994,9 +2994,9 @@ Parser::parseExprCallSuffix(ParserResult<Expr> fn, bool isExprBasic) {
 
   // Parse the argument list.
   SourceLoc lParenLoc, rParenLoc;
-  SmallVector<Expr *, 2> args;
-  SmallVector<Identifier, 2> argLabels;
-  SmallVector<SourceLoc, 2> argLabelLocs;
+  ScratchVector<Expr *> args(*this);
+  ScratchVector<Identifier> argLabels(*this);
+  ScratchVector<SourceLoc> argLabelLocs(*this);
   Expr *trailingClosure;
 
   ParserStatus status = parseExprList(tok::l_paren, tok::r_paren,
@@ -3082,8 +3082,8 @@ ParserResult<Expr> Parser::parseExprCollection(SourceLoc LSquareLoc) {
 ///     '[' ']'
 ParserResult<Expr> Parser::parseExprArray(SourceLoc LSquareLoc,
                                           ParserResult<Expr> FirstExpr) {
-  SmallVector<Expr *, 8> SubExprs;
-  SmallVector<SourceLoc, 8> CommaLocs;
+  ScratchVector<Expr *> SubExprs(*this);
+  ScratchVector<SourceLoc> CommaLocs(*this);
   SubExprs.push_back(FirstExpr.get());
 
   SourceLoc CommaLoc, RSquareLoc;
@@ -3133,7 +3133,7 @@ ParserResult<Expr> Parser::parseExprDictionary(SourceLoc LSquareLoc,
 
   // Each subexpression is a (key, value) tuple.
   // FIXME: We're not tracking the colon locations in the AST.
-  SmallVector<Expr *, 8> SubExprs;
+  ScratchVector<Expr *> SubExprs(*this);
   SourceLoc RSquareLoc;
 
   // Function that adds a new key/value pair.
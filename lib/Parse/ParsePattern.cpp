@@ -779,9 +779,9 @@ ParserResult<Pattern> Parser::parseTypedPattern() {
         }
         
         SourceLoc lParenLoc, rParenLoc;
-        SmallVector<Expr *, 2> args;
-        SmallVector<Identifier, 2> argLabels;
-        SmallVector<SourceLoc, 2> argLabelLocs;
+        ScratchVector<Expr *> args(*this);
+        ScratchVector<Identifier> argLabels(*this);
+        ScratchVector<SourceLoc> argLabelLocs(*this);
         Expr *trailingClosure;
         ParserStatus status = parseExprList(tok::l_paren, tok::r_paren,
                                             /*isPostfix=*/true,
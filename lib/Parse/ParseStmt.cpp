@@ -425,6 +425,13 @@ ParserStatus Parser::parseBraceItems(SmallVectorImpl<ASTNode> &Entries,
       // noisy that way.
       PreviousHadSemi = true;
     }
+
+    // Any scratch storage used while parsing the item is dead now; reclaim
+    // it in bulk so the next top-level declaration starts from an empty
+    // arena.  Don't do this inside a conditional block, whose items are
+    // parsed within an enclosing top-level item.
+    if (IsTopLevel && !isConditionalBlock)
+      ScratchArena.Reset();
   }
 
   return BraceItemsStatus;
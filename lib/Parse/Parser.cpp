@@ -43,22 +43,40 @@ namespace {
 class ParseDelayedFunctionBodies : public ASTWalker {
   PersistentParserState &ParserState;
   CodeCompletionCallbacksFactory *CodeCompletionFactory;
+  bool TransparentBodiesOnly;
 
 public:
   ParseDelayedFunctionBodies(PersistentParserState &ParserState,
-                             CodeCompletionCallbacksFactory *Factory)
-    : ParserState(ParserState), CodeCompletionFactory(Factory) {}
+                             CodeCompletionCallbacksFactory *Factory,
+                             bool TransparentBodiesOnly)
+    : ParserState(ParserState), CodeCompletionFactory(Factory),
+      TransparentBodiesOnly(TransparentBodiesOnly) {}
 
   bool walkToDeclPre(Decl *D) override {
     if (auto AFD = dyn_cast<AbstractFunctionDecl>(D)) {
       if (AFD->getBodyKind() != FuncDecl::BodyKind::Unparsed)
         return false;
+      if (TransparentBodiesOnly && !mayDemandBodyForInlining(AFD))
+        return true;
       parseFunctionBody(AFD);
       return true;
     }
     return true;
   }
 
+private:
+  /// Checks if SIL generation may require the body of this function even
+  /// though Sema never type-checks it, because mandatory inlining needs the
+  /// SIL for calls from other files.
+  static bool mayDemandBodyForInlining(AbstractFunctionDecl *AFD) {
+    const DeclAttributes &Attrs = AFD->getAttrs();
+    if (Attrs.hasAttribute<TransparentAttr>())
+      return true;
+    if (auto *InlineA = Attrs.getAttribute<InlineAttr>())
+      return InlineA->getKind() == InlineKind::Always;
+    return false;
+  }
+
 private:
   void parseFunctionBody(AbstractFunctionDecl *AFD) {
     assert(AFD->getBodyKind() == FuncDecl::BodyKind::Unparsed);
@@ -125,10 +143,12 @@ static void parseDelayedDecl(
 
 void swift::performDelayedParsing(
     DeclContext *DC, PersistentParserState &PersistentState,
-    CodeCompletionCallbacksFactory *CodeCompletionFactory) {
+    CodeCompletionCallbacksFactory *CodeCompletionFactory,
+    bool TransparentBodiesOnly) {
   SharedTimer timer("Parsing");
   ParseDelayedFunctionBodies Walker(PersistentState,
-                                    CodeCompletionFactory);
+                                    CodeCompletionFactory,
+                                    TransparentBodiesOnly);
   DC->walkContext(Walker);
 
   if (CodeCompletionFactory)
@@ -2751,6 +2751,16 @@ public:
 };
 } // end anonymous namespace
 
+// The incremental story for this header lives in two pieces that are easy to
+// miss from here: output ordering is deterministic (top-level decls are
+// printed in name order, not discovery order), and the frontend caller
+// writes to a temporary and only replaces the header when the bytes differ
+// (moveFileIfDifferent). So when nothing @objc-visible changed, the file's
+// content and timestamp are preserved and dependent Objective-C compiles
+// don't rebuild. Any decl whose interface did change forces a full reprint,
+// but the print is a formatting pass over already-typechecked decls —
+// per-decl text caching would save little and would have to invalidate on
+// everything a signature can reference.
 bool swift::printAsObjC(llvm::raw_ostream &os, ModuleDecl *M,
                         StringRef bridgingHeader,
                         Accessibility minRequiredAccess) {
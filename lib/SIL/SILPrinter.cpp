@@ -493,7 +493,13 @@ class SILPrinter : public SILVisitor<SILPrinter> {
   
   SILPrinter &operator<<(SILType t) {
     printSILTypeColorAndSigil(PrintState.OS, t);
-    t.getSwiftRValueType().print(PrintState.OS, PrintState.ASTOptions);
+    CanType rvalueTy = t.getSwiftRValueType();
+    // Alternative type names are specific to this printer, so only print
+    // through the shared per-context cache when they are not in play.
+    if (PrintState.ASTOptions.AlternativeTypeNames)
+      rvalueTy.print(PrintState.OS, PrintState.ASTOptions);
+    else
+      PrintState.OS << Ctx.getTypeText(rvalueTy, PrintState.ASTOptions);
     return *this;
   }
   
@@ -2694,7 +2700,7 @@ void SILPrintContext::initBlockIDs(ArrayRef<const SILBasicBlock *> Blocks) {
   if (Blocks.empty())
     return;
 
-  auto funcCtx = getFuncContext(Blocks[0]->getParent());
+  auto &funcCtx = getFuncContext(Blocks[0]->getParent());
 
   // Initialize IDs so our IDs are in RPOT as well. This is a hack.
   for (unsigned Index : indices(Blocks))
@@ -2702,7 +2708,7 @@ void SILPrintContext::initBlockIDs(ArrayRef<const SILBasicBlock *> Blocks) {
 }
 
 ID SILPrintContext::getID(const SILBasicBlock *Block) {
-  auto funcCtx = getFuncContext(Block->getParent());
+  auto &funcCtx = getFuncContext(Block->getParent());
 
   // Lazily initialize the Blocks-to-IDs mapping.
   // If we are asked to emit sorted SIL, print out our BBs in RPOT order.
@@ -2729,7 +2735,7 @@ ID SILPrintContext::getID(SILValue V) {
   if (isa<SILUndef>(V))
     return {ID::SILUndef, 0};
 
-  auto funcCtx = getFuncContext(V->getFunction());
+  auto &funcCtx = getFuncContext(V->getFunction());
 
   // Lazily initialize the instruction -> ID mapping.
   if (funcCtx.ValueToIDMap.empty()) {
@@ -2739,3 +2745,20 @@ ID SILPrintContext::getID(SILValue V) {
   ID R = {ID::SSAValue, funcCtx.ValueToIDMap[V]};
   return R;
 }
+
+StringRef SILPrintContext::getTypeText(CanType Ty, const PrintOptions &Options){
+  auto known = TypeTextCache.find(Ty.getPointer());
+  if (known != TypeTextCache.end())
+    return known->second;
+
+  SmallString<128> buffer;
+  {
+    llvm::raw_svector_ostream os(buffer);
+    Ty.print(os, Options);
+  }
+  auto *mem = static_cast<char *>(TypeTextAllocator.Allocate(buffer.size(), 1));
+  memcpy(mem, buffer.data(), buffer.size());
+  StringRef text(mem, buffer.size());
+  TypeTextCache[Ty.getPointer()] = text;
+  return text;
+}
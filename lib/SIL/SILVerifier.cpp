@@ -4365,7 +4365,7 @@ void SILGlobalVariable::verify() const {
 }
 
 /// Verify the module.
-void SILModule::verify() const {
+void SILModule::verify(bool verifyFunctions) const {
 #ifdef NDEBUG
   if (!getOptions().VerifyAll)
     return;
@@ -4379,7 +4379,8 @@ void SILModule::verify() const {
       llvm::errs() << "Symbol redefined: " << f.getName() << "!\n";
       assert(false && "triggering standard assertion failure routine");
     }
-    f.verify(/*SingleFunction=*/false);
+    if (verifyFunctions)
+      f.verify(/*SingleFunction=*/false);
   }
 
   // Check all globals.
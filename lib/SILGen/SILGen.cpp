@@ -1374,6 +1374,18 @@ public:
 
 } // end anonymous namespace
 
+// On parallelizing this walk with one SILGenFunction per worker: the
+// SILGenFunctions themselves are mostly independent, but everything they
+// touch underneath is shared and unlocked. All instructions come out of the
+// SILModule's single bump allocator, every lowered type goes through the
+// TypeConverter's mutable cache, and emission is self-extending — visiting
+// one declaration enqueues more work on SGM (forced functions, used
+// conformances, witness tables) and can create new AST nodes in the
+// non-thread-safe ASTContext. Worker threads would also have to buffer their
+// functions and merge them in declaration order to keep output deterministic,
+// since the module's function list order is currently discovery order.
+// A thread-safe SILModule (or per-worker modules with a cheap link step)
+// is the prerequisite; none exists in this tree yet.
 void SILGenModule::emitSourceFile(SourceFile *sf, unsigned startElem) {
   SourceFileScope scope(*this, sf);
   for (Decl *D : llvm::makeArrayRef(sf->Decls).slice(startElem))
@@ -4697,6 +4697,22 @@ static RValue emitApplyAllocatingInitializer(SILGenFunction &SGF,
 }
 
 /// Emit a literal that applies the various initializers.
+///
+/// A recurring proposal is to have SILGen emit pre-folded constants here for
+/// known stdlib literal types (e.g. 'struct $Int (integer_literal ...)')
+/// instead of the builtin-init call chain, so that files full of generated
+/// literal tables don't pay for every later pass to walk the chains. Note
+/// before attempting it: the only layout knowledge SILGen uses today comes
+/// from the initializers the type checker resolved, which keeps stdlib types
+/// and user ExpressibleBy* conformances on one code path. A folding fast
+/// path would have to prove the resolved initializer is the untouched
+/// stdlib one (not shadowed, not resilient) before baking its layout into
+/// emission. Also, the stdlib inits are @_transparent, so mandatory
+/// inlining plus diagnostic constant propagation already collapse the
+/// integer and boolean chains even at -Onone; the residual -Onone runtime
+/// cost is mainly in string interpolation, which is a real call sequence by
+/// design. Any folding effort should start by measuring what the mandatory
+/// pipeline leaves behind, not from the SILGen output.
 RValue SILGenFunction::emitLiteral(LiteralExpr *literal, SGFContext C) {
   ConcreteDeclRef builtinInit;
   ConcreteDeclRef init;
@@ -39,6 +39,16 @@ using namespace swift;
 
 STATISTIC(NumRefCountOpsRemoved, "Total number of increments removed");
 
+/// Enables the loop-region form of the pairing dataflow. With this on (or
+/// via the separate arc-loop-opts pass), loops are summarized bottom-up and
+/// a retain/release of the same RC identity executed on every iteration can
+/// be paired at the loop boundary, i.e. hoisted to the preheader and sunk to
+/// the exits. It stays off by default until the loop summaries have seen
+/// enough validation to be trusted in the shipping pipeline; when evaluating
+/// per-iteration retain traffic, try this flag before reaching for new
+/// mechanisms. Note that batching N increments into one counted runtime call
+/// is not expressible here at all: SIL retains carry no count operand, so
+/// boundary pairing is the strongest loop-carried form available.
 llvm::cl::opt<bool> EnableLoopARC("enable-loop-arc", llvm::cl::init(false));
 
 //===----------------------------------------------------------------------===//
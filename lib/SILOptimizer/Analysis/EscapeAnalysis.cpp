@@ -1127,6 +1127,17 @@ static bool onlyUsedInTupleExtract(SILInstruction *I) {
   return true;
 }
 
+// When a callee is not visible, the apply is treated as fully escaping.
+// Serializing per-function escape summaries into the swiftmodule so that
+// external callees could be handled precisely has been considered and does
+// not fit the model: for serialized (inlinable) functions the module already
+// carries the SIL body, which the linker can import and this analysis can
+// walk, so a summary adds nothing; for non-serialized functions a summary
+// would freeze an implementation detail of the library into every client,
+// and nothing would recompile those clients when a new library version
+// starts escaping an argument - a silent miscompile rather than a
+// conservative result. Cross-boundary precision therefore rides on making
+// the callee's SIL available, not on side-channel summaries.
 bool EscapeAnalysis::buildConnectionGraphForCallees(
     SILInstruction *Caller, CalleeList Callees, FunctionInfo *FInfo,
     FunctionOrder &BottomUpOrder, int RecursionDepth) {
@@ -433,6 +433,15 @@ void SideEffectAnalysis::initialize(SILPassManager *PM) {
   BCA = PM->getAnalysis<BasicCalleeAnalysis>();
 }
 
+// Note: the bottom-up propagation below is deliberately serial even though
+// disjoint call subtrees are independent. The instruction walk in
+// analyzeFunction can pull in callee SIL through the unsynchronized
+// deserializer, effect merging writes into caller FunctionInfos that two
+// subtrees may share (a common utility function has callers in both), and
+// the lazy FunctionInfo allocator and update-ID bookkeeping assume one
+// mutator. The analysis is also demand-driven - most pipelines only ever
+// recompute a small slice - so a whole-module parallel pre-pass would
+// front-load work the serial design often avoids entirely.
 void SideEffectAnalysis::recompute(FunctionInfo *Initial) {
   allocNewUpdateID();
 
@@ -810,7 +810,17 @@ void SILClosureSpecializerTransform::gatherCallSites(
 
       ClosureInfo *CInfo = nullptr;
 
-      // Go through all uses of our closure.
+      // Go through all uses of our closure. Only direct uses are considered:
+      // when the closure first travels through a re-abstraction thunk, the
+      // candidate seen here is the thunk's own partial_apply and the real
+      // closure becomes one of its captured arguments. Following the chain
+      // down to the original closure would require rebuilding each
+      // intermediate thunk application inside the specialized callee and
+      // balancing the +1 of every intermediate context on all exit paths,
+      // while the lifetime-frontier and release bookkeeping below is built
+      // around a single closure value. Such chains are instead handled when
+      // the inliner collapses the thunk, after which the closure reaches its
+      // apply directly and is picked up on a later round of this pass.
       for (auto *Use : II.getUses()) {
         // If this use is not an apply inst or an apply inst with
         // substitutions, there is nothing interesting for us to do, so
@@ -9,6 +9,21 @@
 // See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
 //
 //===----------------------------------------------------------------------===//
+//
+// Note on vectorization: this pass is the SIL half of the vectorization
+// story. Swift does not vectorize at the SIL level - loops over Array<Int>
+// and friends are expected to reach LLVM's loop vectorizer as plain
+// induction loops, and what blocks that in practice is the array bounds
+// trap (a cond_fail inside the body introduces early exits the vectorizer
+// will not speculate past) together with retain/release traffic. Removing
+// and hoisting those checks here, with LICM and unrolling alongside, is
+// what lets the LLVM vectorizer fire. A SIL-level vectorizer emitting
+// Builtin.Vec operations would duplicate LLVM's legality and cost modeling
+// against a representation with far less target information, so loops that
+// still fail to vectorize should be debugged as missed check elimination
+// or leftover ARC operations in this pipeline, not as a missing SIL pass.
+//
+//===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-abcopts"
 
@@ -104,6 +104,18 @@ void LoopCloner::cloneLoop() {
 /// Determine the number of iterations the loop is at most executed. The loop
 /// might contain early exits so this is the maximum if no early exits are
 /// taken.
+///
+/// Only literal bounds are accepted, and that is what keeps this pass small:
+/// a known maximum lets every cloned iteration drop the exit test entirely.
+/// Unrolling loops with symbolic bounds (e.g. an array count obtained in the
+/// preheader) is a different transformation — it must keep the exit tests or
+/// emit a remainder loop, and choosing a sensible factor needs the target
+/// cost model and, ideally, real trip counts. LLVM's unroller downstream has
+/// both and already performs partial and runtime unrolling on the lowered
+/// IR. Unrolling at the SIL level pays off only when it feeds SIL-specific
+/// cleanups — folding the induction variable makes bounds checks and ARC
+/// traffic in the body concrete — and for that, small constant trip counts
+/// are the profitable case.
 static Optional<uint64_t> getMaxLoopTripCount(SILLoop *Loop,
                                               SILBasicBlock *Preheader,
                                               SILBasicBlock *Header,
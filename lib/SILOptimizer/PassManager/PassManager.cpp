@@ -285,6 +285,18 @@ static bool breakBeforeRunning(StringRef fnName, SILFunctionTransform *SFT) {
     && (SFT->getName() == SILBreakOnPass || SFT->getTag() == SILBreakOnPass);
 }
 
+// Count the instructions in \p F. Only used for per-pass reporting, so the
+// walk is paid for exclusively under -sil-print-pass-time.
+static unsigned countInstructions(SILFunction *F) {
+  unsigned Count = 0;
+  for (auto &BB : *F)
+    for (auto &I : BB) {
+      (void)I;
+      ++Count;
+    }
+  return Count;
+}
+
 void SILPassManager::runPassOnFunction(SILFunctionTransform *SFT,
                                        SILFunction *F) {
 
@@ -331,6 +343,7 @@ void SILPassManager::runPassOnFunction(SILFunctionTransform *SFT,
   }
 
   llvm::sys::TimePoint<> StartTime = std::chrono::system_clock::now();
+  unsigned NumInstsBefore = SILPrintPassTime ? countInstructions(F) : 0;
   Mod->registerDeleteNotificationHandler(SFT);
   if (breakBeforeRunning(F->getName(), SFT))
     LLVM_BUILTIN_DEBUGTRAP;
@@ -340,8 +353,10 @@ void SILPassManager::runPassOnFunction(SILFunctionTransform *SFT,
 
   if (SILPrintPassTime) {
     auto Delta = (std::chrono::system_clock::now() - StartTime).count();
-    llvm::dbgs() << Delta << " (" << SFT->getName() << "," << F->getName()
-                 << ")\n";
+    int InstDelta = (int)countInstructions(F) - (int)NumInstsBefore;
+    llvm::dbgs() << Delta << " insts=" << (InstDelta >= 0 ? "+" : "")
+                 << InstDelta << " (" << SFT->getName() << ","
+                 << F->getName() << ")\n";
   }
 
   // If this pass invalidated anything, print and verify.
@@ -365,6 +380,18 @@ void SILPassManager::runPassOnFunction(SILFunctionTransform *SFT,
   ++NumPassesRun;
 }
 
+// Note on parallelism: functions in disjoint call-graph subtrees have no
+// ordering dependency, but running their pipelines concurrently is not an
+// option in this design. Function passes freely mutate module-wide state -
+// the generic specializer and closure specializer create functions, the
+// devirtualizer and inliner deserialize bodies, and all of that goes through
+// the unsynchronized SILModule allocator, function table and ASTContext type
+// uniquing (see the note on SILModule's storage). Analyses are likewise
+// per-module caches keyed by function pointers with no locking, and the
+// worklist-restart and derivation-level bookkeeping below assumes a single
+// mutator. Bottom-up order is kept because it maximizes the callee
+// information available to each caller's pipeline, not as a scheduling
+// constraint that could be relaxed per SCC.
 void SILPassManager::
 runFunctionPasses(ArrayRef<SILFunctionTransform *> FuncTransforms) {
   if (FuncTransforms.empty())
@@ -441,6 +468,8 @@ void SILPassManager::runModulePass(SILModuleTransform *SMT) {
   SMT->injectModule(Mod);
 
   CurrentPassHasInvalidated = false;
+  CurrentPassChangedWholeModule = false;
+  CurrentPassChangedFunctions.clear();
 
   if (SILPrintPassName)
     llvm::dbgs() << "#" << NumPassesRun << " Stage: " << StageName
@@ -475,9 +504,20 @@ void SILPassManager::runModulePass(SILModuleTransform *SMT) {
   }
 
   if (Options.VerifyAll &&
-      (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
-    Mod->verify();
-    verifyAnalyses();
+      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation)) {
+    // If every change the pass reported was attributed to individual
+    // functions, re-verify just those functions along with the module-level
+    // structure; otherwise fall back to verifying the whole module.
+    if (CurrentPassChangedWholeModule || SILVerifyWithoutInvalidation) {
+      Mod->verify();
+      verifyAnalyses();
+    } else {
+      Mod->verify(/*verifyFunctions=*/false);
+      for (SILFunction *F : CurrentPassChangedFunctions) {
+        F->verify(/*SingleFunction=*/false);
+        verifyAnalyses(F);
+      }
+    }
   }
 }
 
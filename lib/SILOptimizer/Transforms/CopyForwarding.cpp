@@ -927,6 +927,18 @@ findAddressRootAndUsers(ValueBase *Def,
 
 /// Perform backward copy-propagation. Find the initialization point of the
 /// copy's source and replace the initializer's address with the copy's dest.
+///
+/// The backward scan is deliberately block-local. Extending it with a
+/// per-block availability dataflow would have to prove, along every path
+/// into the copy's block, both that the source is initialized by the same
+/// address and that the dest is not accessed in between — with address
+/// aliasing that degenerates to the per-instruction use analysis performed
+/// here, run over the whole function for every copy. The profitable
+/// multi-block cases are instead covered by targeted mechanisms: the
+/// destroy hoisting in forwardCopiesOf propagates dead-in blocks through
+/// the CFG, canNRVO handles the "initialized on every branch, copied out
+/// once" pattern directly, and copies between those shapes are usually
+/// exposed block-locally again after inlining and jump threading.
 bool CopyForwarding::backwardPropagateCopy(
   CopyAddrInst *CopyInst,
   SmallPtrSetImpl<SILInstruction*> &DestUserInsts) {
@@ -172,7 +172,18 @@ namespace {
 /// # of BBs x(times) # of locations.
 ///
 /// we could run DSE on functions with 256 basic blocks and 256 locations,
-/// which is a large function.  
+/// which is a large function.
+///
+/// Switching the per-block sets to a sparse representation would not lift
+/// these limits. The sets are one bit per location, so a block's state for
+/// thousands of locations is a few hundred bytes either way, and the
+/// backward dataflow is optimistic: BBWriteSetIn starts as all-ones and the
+/// merge intersects it, so the sets are dense by construction until the fix
+/// point prunes them. What the product below really bounds is the number of
+/// alias and memory-behavior queries made while building gen/kill sets,
+/// which is per (instruction, tracked location) and entirely independent of
+/// how the location sets are stored. Raising the limits means making those
+/// queries cheaper or enumerating fewer locations, not re-encoding the sets.
 constexpr unsigned MaxLSLocationBBMultiplicationNone = 256*256;
 
 /// we could run optimistic DSE on functions with less than 64 basic blocks
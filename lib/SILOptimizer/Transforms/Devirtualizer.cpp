@@ -107,8 +107,14 @@ bool Devirtualizer::devirtualizeAppliesInFunction(SILFunction &F,
     // inlined for some reason, we need to generate code for them.
     // Note that functions, which are only referenced from witness/vtables, are
     // not linked upfront by the SILLinker.
+    //
+    // Normal linking deserializes the devirtualized callee's body and,
+    // transitively, the shared-visibility functions it needs; anything else
+    // the callee references has a home in its defining module, so pulling
+    // those bodies in here would deserialize SIL the inliner may never look
+    // at.
     if (!CalleeFn->isDefinition())
-      F.getModule().linkFunction(CalleeFn, SILModule::LinkingMode::LinkAll);
+      F.getModule().linkFunction(CalleeFn, SILModule::LinkingMode::LinkNormal);
 
     // We may not have optimized these functions yet, and it could
     // be beneficial to rerun some earlier passes on the current
@@ -42,6 +42,15 @@ namespace {
 
 using Weight = ShortestPathAnalysis::Weight;
 
+/// The inliner decides on static weights only. Profile-guided decisions
+/// (scaling the caller weight by measured call-site hotness, refusing
+/// cold-path inlining outright) would need a profile-consumption path that
+/// this compiler does not have: coverage support here is emission-only
+/// (SILGenProfiling writes instrumentation and SILCoverageMap records
+/// regions), and there is no frontend option, profdata reader, or mapping
+/// from counters back to SIL call sites. Until such a path exists,
+/// ColdBlockInfo's static coldness and ShortestPathAnalysis lengths are the
+/// only hotness signals available.
 class SILPerformanceInliner {
   /// Specifies which functions not to inline, based on @_semantics and
   /// global_init attributes.
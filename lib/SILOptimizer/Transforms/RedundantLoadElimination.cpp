@@ -1084,6 +1084,17 @@ void BlockState::processInstructionWithKind(RLEContext &Ctx,
   DEBUG(llvm::dbgs() << "READ " << *Inst);
 }
 
+// These cutoffs are the designed safety valve for the dense formulation:
+// availability is a bit per (location, block), so both the state and the
+// transfer functions scale with the product of the two counts, and very
+// large functions fall back to one pessimistic iteration or opt out
+// entirely. Making availability sparse and per-location would mean building
+// load/store optimization on a memory SSA form, which SIL does not have -
+// there is no def-use graph over memory, no infrastructure to keep one
+// valid across the rewrites this very pass performs, and every other memory
+// pass here reasons through AliasAnalysis queries instead. Until such a
+// form exists, improvements for big functions should target the constant
+// factors of the dense representation rather than its shape.
 RLEContext::ProcessKind
 RLEContext::
 getProcessFunctionKind(unsigned LoadCount, unsigned StoreCount) {
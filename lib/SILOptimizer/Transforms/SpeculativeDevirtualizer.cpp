@@ -482,7 +482,15 @@ static bool tryToSpeculateTarget(FullApplySite AI,
   // checks.
 
   // TODO: The ordering of checks may benefit from using a PGO, because
-  // the most probable alternatives could be checked first.
+  // the most probable alternatives could be checked first. This needs a
+  // profile-consumption path in the frontend first; today no execution
+  // counts reach SIL, so the breadth-first order above is as good a guess
+  // as any. Note also that a checked_cast_br chain is the only shape we
+  // can emit for this dispatch: class metadata addresses are assigned at
+  // link time, so there is no compile-time ordering over isa pointers that
+  // would allow arranging wide hierarchies as a binary search. For
+  // hierarchies wider than MaxNumSpeculativeTargets the miss path keeps
+  // the full class_method dispatch after the chain.
 
   for (auto S : Subs) {
     DEBUG(llvm::dbgs() << "Inserting a speculative call for class "
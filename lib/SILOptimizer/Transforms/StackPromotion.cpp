@@ -108,6 +108,14 @@ bool StackPromotion::tryPromoteAlloc(AllocRefInst *ARI, EscapeAnalysis *EA,
     return false;
 
   // The most important check: does the object escape the current function?
+  //
+  // Note that this is already an interprocedural question: EscapeAnalysis
+  // merges the connection graphs of visible callees into the caller's graph
+  // (see buildConnectionGraphForCallees). An allocation which is only passed
+  // down into helpers that don't let it escape is therefore promoted here,
+  // in the caller, and the callees simply receive a stack reference. The
+  // node only reports an escape for calls into functions whose SIL is not
+  // available, where the analysis has to assume the worst.
   if (Node->escapes())
     return false;
 
@@ -1511,7 +1511,7 @@ void FunctionSignaturePartialSpecializer::computeClonerParamSubs(
 
   SmallVector<Substitution, 4> List;
   CalleeGenericSig->getSubstitutions(SubMap, List);
-  ClonerParamSubs = Ctx.AllocateCopy(List);
+  ClonerParamSubs = Ctx.getUniquedSubstitutionList(List);
   verifySubstitutionList(ClonerParamSubs, "ClonerParamSubs");
 }
 
@@ -1523,7 +1523,7 @@ void FunctionSignaturePartialSpecializer::computeCallerParamSubs(
   SpecializedGenericSig->getSubstitutions(
       SpecializedInterfaceToCallerArchetypeMap, List);
 
-  CallerParamSubs = Ctx.AllocateCopy(List);
+  CallerParamSubs = Ctx.getUniquedSubstitutionList(List);
   verifySubstitutionList(CallerParamSubs, "CallerParamSubs");
 }
 
@@ -2544,6 +2544,17 @@ static SILFunction *lookupExistingSpecialization(SILModule &M,
   // TODO: Cache optimized specializations and perform lookup here?
   // Only check that this function exists, but don't read
   // its body. It can save some compile-time.
+  //
+  // Note on widening this into a general, writable cross-target cache of
+  // specializations: the whitelist is what makes this lookup sound. The
+  // whitelisted symbols live in a library that is built and shipped with the
+  // compiler, so a specialized body can never be stale with respect to the
+  // generic it was cloned from. An on-disk cache populated during user
+  // builds would have no such guarantee - the cache key (mangled specialized
+  // name) says nothing about the generic's body, optimization settings, or
+  // compiler revision that produced the entry, and concurrent frontend jobs
+  // would race on the store. Each of those needs infrastructure this
+  // compiler does not have before automatic reuse is safe.
   if (isWhitelistedSpecialization(FunctionName))
     return M.findFunction(FunctionName, SILLinkage::PublicExternal);
 
@@ -663,6 +663,15 @@ SILFunction *swift::getEligibleFunction(FullApplySite AI,
     }
   }
 
+  // If the callee is only a declaration, try to link its body on demand.
+  // The eager linker passes do not see function references introduced after
+  // they run (devirtualized calls, prespecializations), so ask the loader
+  // for the body the first time the call is considered for inlining. Normal
+  // linking deserializes just the callee and whatever shared-visibility
+  // functions it needs.
+  if (Callee->isExternalDeclaration())
+    AI.getModule().linkFunction(Callee, SILModule::LinkingMode::LinkNormal);
+
   // We can't inline external declarations.
   if (Callee->empty() || Callee->isExternalDeclaration()) {
     return nullptr;
@@ -1390,7 +1390,25 @@ namespace {
                                       TVO_CanBindToInOut);
       ArrayRef<ValueDecl*> decls = expr->getDecls();
       SmallVector<OverloadChoice, 4> choices;
-      
+
+      // If we know how this reference gets applied, screen out candidates
+      // whose parameters cannot accept the argument list, the same way
+      // member lookup does.  Operators routinely have dozens of visible
+      // overloads, and every candidate we admit here becomes a disjunction
+      // term the solver has to explore.
+      auto knownLabels = CS.ArgumentLabels.find(locator);
+      auto isApplicableDecl = [&](ValueDecl *decl) -> bool {
+        if (knownLabels == CS.ArgumentLabels.end())
+          return true;
+
+        auto &labels = knownLabels->second;
+        unsigned parameterDepth =
+          decl->getDeclContext()->isTypeContext() ? 1 : 0;
+        return areConservativelyCompatibleArgumentLabels(
+                 decl, parameterDepth, labels.Labels,
+                 labels.HasTrailingClosure);
+      };
+
       for (unsigned i = 0, n = decls.size(); i != n; ++i) {
         // If the result is invalid, skip it.
         // FIXME: Note this as invalid, in case we don't find a solution,
@@ -1399,10 +1417,25 @@ namespace {
         if (decls[i]->isInvalid())
           continue;
 
+        if (!isApplicableDecl(decls[i]))
+          continue;
+
         choices.push_back(OverloadChoice(Type(), decls[i],
                                          expr->getFunctionRefKind()));
       }
 
+      // If the screening removed everything, fall back to the full set so
+      // diagnostics still have candidates to talk about.
+      if (choices.empty()) {
+        for (unsigned i = 0, n = decls.size(); i != n; ++i) {
+          if (decls[i]->isInvalid())
+            continue;
+
+          choices.push_back(OverloadChoice(Type(), decls[i],
+                                           expr->getFunctionRefKind()));
+        }
+      }
+
       // If there are no valid overloads, give up.
       if (choices.empty())
         return nullptr;
@@ -3153,6 +3186,20 @@ namespace {
         return { true, expr };
       }
 
+      // Record operator applications as well; their argument labels are
+      // always empty, but knowing the arity lets overload-set construction
+      // screen out candidates that cannot accept the operands.
+      if (isa<BinaryExpr>(expr) || isa<PrefixUnaryExpr>(expr) ||
+          isa<PostfixUnaryExpr>(expr)) {
+        auto apply = cast<ApplyExpr>(expr);
+        SmallVector<Identifier, 2> scratch;
+        associateArgumentLabels(apply->getFn(),
+                                { apply->getArgumentLabels(scratch),
+                                  /*hasTrailingClosure=*/false },
+                                /*labelsArePermanent=*/false);
+        return { true, expr };
+      }
+
       // FIXME: other expressions have argument labels, but this is an
       // optimization, so stage it in later.
       return { true, expr };
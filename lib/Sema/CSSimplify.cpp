@@ -2637,8 +2637,7 @@ ConstraintSystem::SolutionKind ConstraintSystem::simplifyConformsToConstraint(
       return SolutionKind::Solved;
     }
     break;
-  case ConstraintKind::ConformsTo:
-  case ConstraintKind::LiteralConformsTo: {
+  case ConstraintKind::ConformsTo: {
     // Check whether this type conforms to the protocol.
     if (auto conformance =
           TC.conformsToProtocol(type, protocol, DC,
@@ -2650,6 +2649,18 @@ ConstraintSystem::SolutionKind ConstraintSystem::simplifyConformsToConstraint(
     break;
   }
 
+  case ConstraintKind::LiteralConformsTo: {
+    // Literal constraints check the same few types against the same few
+    // protocols over and over; use the memoized lookup.
+    if (auto conformance =
+          TC.conformsToLiteralProtocol(type, protocol, DC)) {
+      CheckedConformances.push_back({getConstraintLocator(locator),
+                                     *conformance});
+      return SolutionKind::Solved;
+    }
+    break;
+  }
+
   default:
     llvm_unreachable("bad constraint kind");
   }
@@ -17,6 +17,7 @@
 #include "ConstraintGraph.h"
 #include "swift/AST/ParameterList.h"
 #include "swift/AST/TypeWalker.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/raw_ostream.h"
@@ -764,6 +765,73 @@ ConstraintSystem::solveSingle(FreeTypeVariableBinding allowFreeTypeVariables) {
   return std::move(solutions[0]);
 }
 
+/// Flatten the pieces of an expression tree that determine how the shrink
+/// pass reduces its overload domains: node kinds, referenced declarations,
+/// member and argument names, and any concrete types already assigned.
+/// Literal values are deliberately ignored because they do not affect
+/// overload selection.  If \p overloadSets is given, the overload set
+/// references are collected in traversal order.
+static void flattenShrinkShape(
+    Expr *E, Type contextualType, ContextualTypePurpose CTP,
+    SmallVectorImpl<uintptr_t> &shape,
+    SmallVectorImpl<OverloadSetRefExpr *> *overloadSets) {
+  auto record = [&](Expr *expr) {
+    shape.push_back(unsigned(expr->getKind()));
+
+    if (auto *OSR = dyn_cast<OverloadSetRefExpr>(expr)) {
+      auto decls = OSR->getDecls();
+      shape.push_back(decls.size());
+      for (auto *decl : decls)
+        shape.push_back(reinterpret_cast<uintptr_t>(decl));
+      if (overloadSets)
+        overloadSets->push_back(OSR);
+    } else if (auto *DRE = dyn_cast<DeclRefExpr>(expr)) {
+      shape.push_back(reinterpret_cast<uintptr_t>(DRE->getDecl()));
+    } else if (auto *MRE = dyn_cast<MemberRefExpr>(expr)) {
+      shape.push_back(
+          reinterpret_cast<uintptr_t>(MRE->getMember().getDecl()));
+    } else if (auto *UDRE = dyn_cast<UnresolvedDeclRefExpr>(expr)) {
+      shape.push_back(
+          reinterpret_cast<uintptr_t>(UDRE->getName().getBaseName().get()));
+    } else if (auto *UDE = dyn_cast<UnresolvedDotExpr>(expr)) {
+      shape.push_back(
+          reinterpret_cast<uintptr_t>(UDE->getName().getBaseName().get()));
+    } else if (auto *TE = dyn_cast<TupleExpr>(expr)) {
+      for (auto name : TE->getElementNames())
+        shape.push_back(reinterpret_cast<uintptr_t>(name.get()));
+    }
+
+    if (auto type = expr->getType()) {
+      if (!type->hasTypeVariable())
+        shape.push_back(reinterpret_cast<uintptr_t>(
+            type->getCanonicalType().getPointer()));
+    }
+  };
+
+  record(E);
+  E->forEachChildExpr([&](Expr *child) -> Expr * {
+    record(child);
+    return child;
+  });
+
+  shape.push_back(uintptr_t(CTP));
+  shape.push_back(contextualType
+                      ? reinterpret_cast<uintptr_t>(
+                            contextualType->getCanonicalType().getPointer())
+                      : 0);
+}
+
+/// Hash a flattened expression shape, avoiding the DenseMap sentinel keys.
+static uint64_t hashShrinkShape(ArrayRef<uintptr_t> shape) {
+  uint64_t hash = llvm::hash_combine_range(shape.begin(), shape.end());
+  if (hash == uint64_t(-1) || hash == uint64_t(-2))
+    hash = 0;
+  return hash;
+}
+
+/// Keep the shrink-domain cache from growing without bound on huge modules.
+static const unsigned MaxShrunkDomainCacheSize = 4096;
+
 bool ConstraintSystem::Candidate::solve(
     llvm::SmallDenseSet<OverloadSetRefExpr *> &shrunkExprs) {
   // Don't attempt to solve candidate if there is closure
@@ -781,6 +849,37 @@ bool ConstraintSystem::Candidate::solve(
   if (containsClosure)
     return false;
 
+  // Machine-generated and heavily literal-laden code tends to repeat the
+  // same expression shapes many times.  If we have already shrunk an
+  // identical shape, replay the recorded domain reductions instead of
+  // re-solving; ExprCleaner would restore the expression types anyway, so
+  // skipping the solve is state-equivalent.
+  SmallVector<uintptr_t, 32> shape;
+  SmallVector<OverloadSetRefExpr *, 4> overloadSets;
+  flattenShrinkShape(E, CT, CTP, shape, &overloadSets);
+  auto shapeHash = hashShrinkShape(shape);
+
+  auto cached = TC.ShrunkDomainCache.find(shapeHash);
+  if (cached != TC.ShrunkDomainCache.end() &&
+      cached->second.Shape.size() == shape.size() &&
+      std::equal(shape.begin(), shape.end(), cached->second.Shape.begin()) &&
+      cached->second.Domains.size() == overloadSets.size()) {
+    for (unsigned i = 0, n = overloadSets.size(); i != n; ++i) {
+      auto &domain = cached->second.Domains[i];
+      auto *OSR = overloadSets[i];
+      if (domain.empty() || domain.size() >= OSR->getDecls().size())
+        continue;
+
+      MutableArrayRef<ValueDecl *> decls(
+          Allocator.Allocate<ValueDecl *>(domain.size()), domain.size());
+      std::copy(domain.begin(), domain.end(), decls.begin());
+
+      OSR->setDecls(decls);
+      shrunkExprs.insert(OSR);
+    }
+    return false;
+  }
+
   auto cleanupImplicitExprs = [&](Expr *expr) {
     expr->forEachChildExpr([&](Expr *childExpr) -> Expr * {
       Type type = childExpr->getType();
@@ -868,6 +967,27 @@ bool ConstraintSystem::Candidate::solve(
   // Record found solutions as suggestions.
   this->applySolutions(solutions, shrunkExprs);
 
+  // Remember the reduced domains for this shape so identical candidates
+  // don't have to be re-solved.  Failures aren't cached because they take
+  // the salvaging path, which we don't want to short-circuit.
+  if (!solutions.empty()) {
+    if (TC.ShrunkDomainCache.size() >= MaxShrunkDomainCacheSize)
+      TC.ShrunkDomainCache.clear();
+
+    auto &entry = TC.ShrunkDomainCache[shapeHash];
+    if (entry.Shape.empty()) {
+      entry.Shape.assign(shape.begin(), shape.end());
+      entry.Domains.reserve(overloadSets.size());
+      for (auto *OSR : overloadSets) {
+        entry.Domains.emplace_back();
+        if (shrunkExprs.count(OSR)) {
+          auto decls = OSR->getDecls();
+          entry.Domains.back().assign(decls.begin(), decls.end());
+        }
+      }
+    }
+  }
+
   // Let's double-check if we have any implicit expressions
   // with type variables and nullify their types.
   cleanupImplicitExprs(E);
@@ -1356,6 +1476,8 @@ ConstraintSystem::solve(Expr *&expr,
   // "too complex". Maintain that behavior, but for Swift > 3 return
   // Unsolved in these cases.
   auto tooComplex = getExpressionTooComplex(solutions);
+  if (tooComplex && shouldAcceptPartialSolutions(solutions))
+    tooComplex = false;
   auto unsolved = tooComplex || solutions.empty();
 
   return unsolved ? SolutionKind::Unsolved : SolutionKind::Solved;
@@ -1832,8 +1954,33 @@ bool ConstraintSystem::solveSimplified(
 
   ++solverState->NumDisjunctions;
   auto constraints = disjunction->getNestedConstraints();
+
+  // Partition the choices so that the ones most likely to produce a cheap,
+  // non-generic solution are attempted first: favored choices, then the
+  // rest, with generic and unavailable operator overloads last.  Finding a
+  // non-generic operator solution early lets the generic overloads be
+  // skipped outright by shouldSkipDisjunctionChoice instead of explored
+  // and merely out-ranked.
+  SmallVector<unsigned, 4> choiceOrder;
+  {
+    SmallVector<unsigned, 4> otherChoices;
+    SmallVector<unsigned, 4> genericOrUnavailableChoices;
+    for (auto index : indices(constraints)) {
+      if (constraints[index]->isFavored())
+        choiceOrder.push_back(index);
+      else if (DisjunctionChoice(this, constraints[index])
+                   .isGenericOperatorOrUnavailable())
+        genericOrUnavailableChoices.push_back(index);
+      else
+        otherChoices.push_back(index);
+    }
+    choiceOrder.append(otherChoices.begin(), otherChoices.end());
+    choiceOrder.append(genericOrUnavailableChoices.begin(),
+                       genericOrUnavailableChoices.end());
+  }
+
   // Try each of the constraints within the disjunction.
-  for (auto index : indices(constraints)) {
+  for (auto index : choiceOrder) {
     auto currentChoice = DisjunctionChoice(this, constraints[index]);
     if (shouldSkipDisjunctionChoice(*this, currentChoice, bestNonGenericScore))
       continue;
@@ -1905,8 +2052,11 @@ bool ConstraintSystem::solveSimplified(
   CG.addConstraint(disjunction);
 
   // If we are exiting due to an expression that is too complex, do
-  // not allow our caller to continue as if we have been successful.
+  // not allow our caller to continue as if we have been successful,
+  // unless anytime mode lets us settle for the solutions in hand.
   auto tooComplex = getExpressionTooComplex(solutions);
+  if (tooComplex && shouldAcceptPartialSolutions(solutions))
+    tooComplex = false;
   return tooComplex || !lastSolvedChoice;
 }
 
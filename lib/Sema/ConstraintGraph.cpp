@@ -516,43 +516,6 @@ void ConstraintGraph::gatherConstraints(
 
 #pragma mark Algorithms
 
-/// Depth-first search for connected components
-static void connectedComponentsDFS(ConstraintGraph &cg,
-                                   ConstraintGraphNode &node,
-                                   unsigned component,
-                                   SmallVectorImpl<unsigned> &components) {
-  // Local function that recurses on the given set of type variables.
-  auto visitAdjacencies = [&](ArrayRef<TypeVariableType *> typeVars) {
-    for (auto adj : typeVars) {
-      auto nodeAndIndex = cg.lookupNode(adj);
-      // If we've already seen this node in this component, we're done.
-      unsigned &curComponent = components[nodeAndIndex.second];
-      if (curComponent == component)
-        continue;
-
-      // Mark this node as part of this connected component, then recurse.
-      assert(curComponent == components.size() && "Already in a component?");
-      curComponent = component;
-      connectedComponentsDFS(cg, nodeAndIndex.first, component, components);
-    }
-  };
-
-  // Recurse to mark adjacent nodes as part of this connected component.
-  visitAdjacencies(node.getAdjacencies());
-
-  // Figure out the representative for this type variable.
-  auto &cs = cg.getConstraintSystem();
-  auto typeVarRep = cs.getRepresentative(node.getTypeVariable());
-  if (typeVarRep == node.getTypeVariable()) {
-    // This type variable is the representative of its set; visit all of the
-    // other type variables in the same equivalence class.
-    visitAdjacencies(node.getEquivalenceClass().slice(1));
-  } else {
-    // Otherwise, visit the representative of the set.
-    visitAdjacencies(typeVarRep);
-  }
-}
-
 unsigned ConstraintGraph::computeConnectedComponents(
            SmallVectorImpl<TypeVariableType *> &typeVars,
            SmallVectorImpl<unsigned> &components) {
@@ -561,31 +524,69 @@ unsigned ConstraintGraph::computeConnectedComponents(
                                                          typeVars.end());
   typeVars.clear();
 
-  // Initialize the components with component == # of type variables,
-  // a sentinel value indicating
   unsigned numTypeVariables = TypeVariables.size();
-  components.assign(numTypeVariables, numTypeVariables);
 
-  // Perform a depth-first search from each type variable to identify
-  // what component it is in.
-  unsigned numComponents = 0;
+  // Compute the components with a union-find over the node indices.  This
+  // runs on every recursive step of the solver, and the flat passes here
+  // replace a depth-first search whose recursion grew with the diameter of
+  // the component; deeply nested expressions made that stack excursion (and
+  // its per-node closure calls) a measurable cost.
+  SmallVector<unsigned, 16> parent(numTypeVariables);
+  SmallVector<unsigned, 16> rank(numTypeVariables, 0);
+  for (unsigned i = 0; i != numTypeVariables; ++i)
+    parent[i] = i;
+
+  // Find the root for the given node index, halving the path as we go.
+  auto find = [&](unsigned i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+
+  // Place the two given node indices in the same component.
+  auto unite = [&](unsigned a, unsigned b) {
+    a = find(a);
+    b = find(b);
+    if (a == b)
+      return;
+    if (rank[a] < rank[b])
+      std::swap(a, b);
+    parent[b] = a;
+    if (rank[a] == rank[b])
+      ++rank[a];
+  };
+
   for (unsigned i = 0; i != numTypeVariables; ++i) {
     auto typeVar = TypeVariables[i];
+    auto &node = lookupNode(typeVar).first;
 
-    // Look up the node for this type variable.
-    auto nodeAndIndex = lookupNode(typeVar);
+    // Adjacent type variables share a component.
+    for (auto adj : node.getAdjacencies())
+      unite(i, lookupNode(adj).second);
 
-    // If we're already assigned a component for this node, skip it.
-    unsigned &curComponent = components[nodeAndIndex.second];
-    if (curComponent != numTypeVariables)
-      continue;
-
-    // Record this component.
-    unsigned component = numComponents++;
+    // So do all of the members of an equivalence class.  Mirror the fixed
+    // bindings: the representative carries the whole class, everyone else
+    // just links to the representative.
+    auto typeVarRep = CS.getRepresentative(typeVar);
+    if (typeVarRep == typeVar) {
+      for (auto equiv : node.getEquivalenceClass().slice(1))
+        unite(i, lookupNode(equiv).second);
+    } else {
+      unite(i, lookupNode(typeVarRep).second);
+    }
+  }
 
-    // Note that this node is part of this component, then visit it.
-    curComponent = component;
-    connectedComponentsDFS(*this, nodeAndIndex.first, component, components);
+  // Number the components in order of first appearance, which matches the
+  // order the search-based version produced.
+  components.assign(numTypeVariables, numTypeVariables);
+  unsigned numComponents = 0;
+  for (unsigned i = 0; i != numTypeVariables; ++i) {
+    unsigned root = find(i);
+    if (components[root] == numTypeVariables)
+      components[root] = numComponents++;
+    components[i] = components[root];
   }
 
   // Figure out which components have unbound type variables; these
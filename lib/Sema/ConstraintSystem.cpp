@@ -49,6 +49,7 @@ ExpressionTimer::~ExpressionTimer() {
 ConstraintSystem::ConstraintSystem(TypeChecker &tc, DeclContext *dc,
                                    ConstraintSystemOptions options)
   : TC(tc), DC(dc), Options(options),
+    Allocator(tc.takeSolverAllocator()),
     Arena(tc.Context, Allocator),
     CG(*new ConstraintGraph(*this))
 {
@@ -57,6 +58,16 @@ ConstraintSystem::ConstraintSystem(TypeChecker &tc, DeclContext *dc,
 
 ConstraintSystem::~ConstraintSystem() {
   delete &CG;
+
+  // The constraints in this list live in the arena below. Recycling the
+  // allocator resets the arena before our members are destroyed, so drop the
+  // list's links without touching the (about-to-be-freed) nodes; otherwise
+  // ~ilist would unlink each node and scribble on recycled memory.
+  InactiveConstraints.clearAndLeakNodesUnsafely();
+
+  // Everything allocated for this system is dead now; hand the allocator
+  // back so the next expression can reuse its warm slab.
+  TC.recycleSolverAllocator(std::move(Allocator));
 }
 
 void ConstraintSystem::incrementScopeCounter() {
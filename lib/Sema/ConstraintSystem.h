@@ -595,6 +595,11 @@ public:
   llvm::SmallVector<std::pair<ConstraintLocator *, ProtocolConformanceRef>, 8>
       Conformances;
 
+  /// Whether the solver stopped exploring before covering the whole
+  /// solution space, so a better-ranked solution may exist.  Set when the
+  /// anytime latency budget cuts the search short.
+  bool MaybeSuboptimal = false;
+
   /// \brief Simplify the given type by substituting all occurrences of
   /// type variables for their fixed types.
   Type simplifyType(Type type) const;
@@ -2798,6 +2803,15 @@ public:
         Timer->disableWarning();
         return true;
       }
+
+      // In anytime mode, stop exploring once the latency budget is spent;
+      // the caller settles for the best solution found so far.
+      if (auto budget = TC.getSolverAnytimeBudgetInMilliseconds()) {
+        if (elapsed * 1000.0 >= budget) {
+          Timer->disableWarning();
+          return true;
+        }
+      }
     }
 
     if (!getASTContext().isSwiftVersion3()) {
@@ -2827,6 +2841,20 @@ public:
     auto threshold = TC.Context.LangOpts.SolverMemoryThreshold;
     return MaxMemory > threshold;
   }
+
+  /// \brief In anytime mode, a "too complex" verdict with solutions already
+  /// in hand means "settle for the best of them" rather than failure.
+  ///
+  /// Marks the solutions as possibly suboptimal and returns true if they
+  /// should be accepted.
+  bool shouldAcceptPartialSolutions(SmallVectorImpl<Solution> &solutions) {
+    if (solutions.empty() || TC.getSolverAnytimeBudgetInMilliseconds() == 0)
+      return false;
+
+    for (auto &solution : solutions)
+      solution.MaybeSuboptimal = true;
+    return true;
+  }
   
   LLVM_ATTRIBUTE_DEPRECATED(
       void dump() LLVM_ATTRIBUTE_USED,
@@ -73,28 +73,48 @@ void IterativeTypeChecker::satisfy(TypeCheckRequest request) {
   // If the request has already been satisfied, we're done.
   if (isSatisfied(request)) return;
 
-  // Check for circular dependencies in our requests.
-  // FIXME: This stack operation is painfully inefficient.
-  auto existingRequest = std::find(ActiveRequests.rbegin(),
-                                   ActiveRequests.rend(),
-                                   request);
-  if (existingRequest != ActiveRequests.rend()) {
-    auto first = existingRequest.base();
-    --first;
-    diagnoseCircularReference(llvm::makeArrayRef(&*first,
-                                                 &*ActiveRequests.end()));
+  // Local function that starts tracking the given request, diagnosing
+  // circular references.  Returns false if the request is already active.
+  auto pushActiveRequest = [&](TypeCheckRequest req) -> bool {
+    // FIXME: This stack operation is painfully inefficient.
+    auto existingRequest = std::find(ActiveRequests.rbegin(),
+                                     ActiveRequests.rend(),
+                                     req);
+    if (existingRequest != ActiveRequests.rend()) {
+      auto first = existingRequest.base();
+      --first;
+      diagnoseCircularReference(llvm::makeArrayRef(&*first,
+                                                   &*ActiveRequests.end()));
+      return false;
+    }
+
+    ActiveRequests.push_back(req);
+    return true;
+  };
+
+  if (!pushActiveRequest(request))
     return;
-  }
 
-  // Add this request to the stack of active requests.
-  ActiveRequests.push_back(request);
-  SWIFT_DEFER { ActiveRequests.pop_back(); };
+  // Schedule requests from the explicit dependency stack rather than
+  // recursing; dependency chains through deeply nested declarations
+  // otherwise translate directly into C++ stack depth.  The stack holds
+  // the chain of requests blocked on their dependencies, with the most
+  // recently discovered dependency on top.
+  unsigned baseDepth = ActiveRequests.size() - 1;
+  while (ActiveRequests.size() > baseDepth) {
+    auto current = ActiveRequests.back();
+
+    // A request further down the chain may have satisfied this one
+    // transitively.
+    if (isSatisfied(current)) {
+      ActiveRequests.pop_back();
+      continue;
+    }
 
-  while (true) {
-    // Process this requirement, enumerating dependencies if anything else needs
-    // to be handled first.
+    // Process this requirement, enumerating dependencies if anything else
+    // needs to be handled first.
     SmallVector<TypeCheckRequest, 4> unsatisfied;
-    process(request, [&](TypeCheckRequest dependency) -> bool {
+    process(current, [&](TypeCheckRequest dependency) -> bool {
       if (isSatisfied(dependency)) return false;
 
       // Record the unsatisfied dependency.
@@ -102,17 +122,21 @@ void IterativeTypeChecker::satisfy(TypeCheckRequest request) {
       return true;
     });
 
-    // If there were no unsatisfied dependencies, we're done.
+    // If there were no unsatisfied dependencies, we're done with this
+    // request.
     if (unsatisfied.empty()) {
-      assert(isSatisfied(request));
-      break;
+      assert(isSatisfied(current));
+      ActiveRequests.pop_back();
+      continue;
     }
 
-    // Recurse to satisfy any unsatisfied dependencies.
-    // FIXME: Don't recurse in the iterative type checker, silly!
-    for (auto dependency : unsatisfied) {
-      satisfy(dependency);
-    }
+    // Schedule the first unsatisfied dependency and revisit this request
+    // afterward; the handlers bail at their first missing input, so any
+    // remaining dependencies get rediscovered then (and may have been
+    // satisfied transitively in the meantime).  If scheduling it diagnosed
+    // a circular reference, the cycle was broken, so revisiting makes
+    // progress either way.
+    pushActiveRequest(unsatisfied.front());
   }
 }
 
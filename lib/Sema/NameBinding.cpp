@@ -307,6 +307,17 @@ static void insertPrecedenceGroupDecl(NameBinder &binder, SourceFile &SF,
 /// At this parsing has been performed, but we still have UnresolvedDeclRefExpr
 /// nodes for unresolved value names, and we may have unresolved type names as
 /// well.  This handles import directives and forward references.
+/// On sharing import-resolution state across files: most of what this pass
+/// computes is per-file by language rule, not by accident. Which modules are
+/// visible, with what access path, and what shadows what are properties of
+/// this file's own ImportDecls, so there is no module-wide result to build
+/// once and attach. The genuinely shared work — actually loading a module —
+/// is already cached in the ASTContext's loaded-modules table, so the 2,000th
+/// file importing Foundation performs a lookup, not a load. (The
+/// TreeScopedHashTable sometimes mentioned in this connection belongs to the
+/// parser's Scope machinery, not to this pass.) Sharing beyond one frontend
+/// process would need a serialized form of this state and a frontend mode
+/// that consumes it; neither exists here.
 void swift::performNameBinding(SourceFile &SF, unsigned StartElem) {
   // Make sure we skip adding the standard library imports if the
   // source file is empty.
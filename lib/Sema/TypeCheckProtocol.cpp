@@ -5490,6 +5490,33 @@ Optional<ProtocolConformanceRef> TypeChecker::conformsToProtocol(
   return lookupResult;
 }
 
+Optional<ProtocolConformanceRef>
+TypeChecker::conformsToLiteralProtocol(Type T, ProtocolDecl *Proto,
+                                       DeclContext *DC) {
+  auto key = std::make_pair(DC->getParentModule(),
+                            std::make_pair(T->getCanonicalType().getPointer(),
+                                           Proto));
+
+  auto known = LiteralConformanceCache.find(key);
+  if (known != LiteralConformanceCache.end()) {
+    // The module lookup is what we memoized; dependency tracking is per
+    // use site, so repeat it for this one.
+    auto conformance = known->second;
+    if (auto nominal = T->getAnyNominal())
+      recordConformanceDependency(DC, nominal,
+                                  conformance.isConcrete()
+                                    ? conformance.getConcrete() : nullptr,
+                                  /*InExpression=*/true);
+    return conformance;
+  }
+
+  auto lookupResult = conformsToProtocol(T, Proto, DC,
+                                         ConformanceCheckFlags::InExpression);
+  if (lookupResult)
+    LiteralConformanceCache.insert({key, *lookupResult});
+  return lookupResult;
+}
+
 ConformsToProtocolResult
 TypeChecker::conformsToProtocol(Type T, ProtocolDecl *Proto, DeclContext *DC,
                                 ConformanceCheckOptions options,
@@ -623,7 +623,8 @@ void swift::performTypeChecking(SourceFile &SF, TopLevelContext &TLC,
                                 unsigned StartElem,
                                 unsigned WarnLongFunctionBodies,
                                 unsigned WarnLongExpressionTypeChecking,
-                                unsigned ExpressionTimeoutThreshold) {
+                                unsigned ExpressionTimeoutThreshold,
+                                unsigned SolverAnytimeBudget) {
   if (SF.ASTStage == SourceFile::TypeChecked)
     return;
 
@@ -652,6 +653,9 @@ void swift::performTypeChecking(SourceFile &SF, TopLevelContext &TLC,
       if (ExpressionTimeoutThreshold != 0)
         MyTC->setExpressionTimeoutThreshold(ExpressionTimeoutThreshold);
 
+      if (SolverAnytimeBudget != 0)
+        MyTC->setSolverAnytimeBudgetInMilliseconds(SolverAnytimeBudget);
+
       if (Options.contains(TypeCheckingFlags::DebugTimeFunctionBodies))
         MyTC->enableDebugTimeFunctionBodies();
 
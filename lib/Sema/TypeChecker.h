@@ -32,6 +32,7 @@
 #include "swift/Config.h"
 #include "llvm/ADT/SetVector.h"
 #include "llvm/ADT/TinyPtrVector.h"
+#include "llvm/Support/Allocator.h"
 #include <functional>
 
 namespace swift {
@@ -705,9 +706,67 @@ public:
     TypeAccessScopeCache;
 
   // Caches whether a given declaration is "as specialized" as another.
-  llvm::DenseMap<std::pair<ValueDecl*, ValueDecl*>, bool> 
+  llvm::DenseMap<std::pair<ValueDecl*, ValueDecl*>, bool>
     specializedOverloadComparisonCache;
-  
+
+  /// The reduced overload domains computed by the constraint solver's shrink
+  /// pass for one structurally distinct expression shape.
+  ///
+  /// Generated code tends to repeat the same expression shapes (same
+  /// operators, same literal kinds, same contextual type) many times;
+  /// replaying the recorded domains avoids re-running the partial solver
+  /// for every copy.
+  struct ShrunkOverloadDomains {
+    /// The flattened structural fingerprint of the expression, kept to
+    /// reject hash collisions with an exact comparison.
+    std::vector<uintptr_t> Shape;
+
+    /// The reduced candidate set for each overload set reference in the
+    /// expression, in traversal order.  An empty set records that the
+    /// corresponding domain could not be reduced.
+    std::vector<std::vector<ValueDecl *>> Domains;
+  };
+
+  /// Shrink-pass outcomes keyed by a structural hash of the expression and
+  /// its contextual type.  See \c ShrunkOverloadDomains.
+  llvm::DenseMap<uint64_t, ShrunkOverloadDomains> ShrunkDomainCache;
+
+  /// Memoized module conformance lookups for the ExpressibleBy* literal
+  /// protocols, keyed by (module, canonical type, protocol).  Only
+  /// successful lookups are cached; a failure may be transient while
+  /// conformances are still being synthesized.
+  llvm::DenseMap<std::pair<ModuleDecl *,
+                           std::pair<TypeBase *, ProtocolDecl *>>,
+                 ProtocolConformanceRef>
+    LiteralConformanceCache;
+
+  /// \brief Retired constraint-system allocators.
+  ///
+  /// A constraint system is created and torn down for every expression (and
+  /// for every candidate the shrink pass solves), and each one used to pay
+  /// malloc for its first slab.  Retired allocators are bulk-reset and kept
+  /// here, so consecutive expressions in the same body reuse a warm slab.
+  SmallVector<llvm::BumpPtrAllocator, 2> SolverAllocatorPool;
+
+  /// Take an allocator for a new constraint system, reusing a retired one
+  /// when available.
+  llvm::BumpPtrAllocator takeSolverAllocator() {
+    if (SolverAllocatorPool.empty())
+      return llvm::BumpPtrAllocator();
+    llvm::BumpPtrAllocator result = std::move(SolverAllocatorPool.back());
+    SolverAllocatorPool.pop_back();
+    return result;
+  }
+
+  /// Return a constraint system's allocator to the pool.  The pool is kept
+  /// small; it only needs to cover the nesting depth of live systems.
+  void recycleSolverAllocator(llvm::BumpPtrAllocator &&allocator) {
+    if (SolverAllocatorPool.size() >= 4)
+      return;
+    allocator.Reset();
+    SolverAllocatorPool.push_back(std::move(allocator));
+  }
+
   // We delay validation of C and Objective-C type-bridging functions in the
   // standard library until we encounter a declaration that requires one. This
   // flag is set to 'true' once the bridge functions have been checked.
@@ -859,6 +918,12 @@ private:
   /// than this many seconds.
   unsigned ExpressionTimeoutThreshold = 600;
 
+  /// If non-zero, the expression type checker settles for the best solution
+  /// found so far after this many milliseconds instead of failing, marking
+  /// it as possibly suboptimal.  Intended for interactive requests, where
+  /// latency matters more than picking the optimal overload.
+  unsigned SolverAnytimeBudget = 0;
+
   /// If true, the time it takes to type-check each function will be dumped
   /// to llvm::errs().
   bool DebugTimeFunctionBodies = false;
@@ -936,6 +1001,19 @@ public:
     return ExpressionTimeoutThreshold;
   }
 
+  /// Set the number of milliseconds the expression type checker may spend
+  /// exploring the solution space before settling for the best solution
+  /// found so far.  Zero (the default) disables anytime mode.
+  void setSolverAnytimeBudgetInMilliseconds(unsigned timeInMS) {
+    SolverAnytimeBudget = timeInMS;
+  }
+
+  /// Return the anytime latency budget for the expression type checker,
+  /// in milliseconds, or zero if anytime mode is disabled.
+  unsigned getSolverAnytimeBudgetInMilliseconds() {
+    return SolverAnytimeBudget;
+  }
+
   bool getInImmediateMode() {
     return InImmediateMode;
   }
@@ -1932,6 +2010,16 @@ public:
                                      ConformanceCheckOptions options,
                                      SourceLoc ComplainLoc = SourceLoc());
 
+  /// Check conformance to one of the ExpressibleBy* literal protocols,
+  /// memoizing successful lookups.
+  ///
+  /// Literal constraints check the same few types against the same few
+  /// protocols constantly, so the module lookup cascade is worth caching;
+  /// per-use-site dependency recording still happens on every call.
+  Optional<ProtocolConformanceRef> conformsToLiteralProtocol(Type T,
+                                                             ProtocolDecl *Proto,
+                                                             DeclContext *DC);
+
   /// A version of the above meant for use with the iterative type checker.
   ConformsToProtocolResult
   conformsToProtocol(Type T, ProtocolDecl *Proto, DeclContext *DC,
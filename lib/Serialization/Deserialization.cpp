@@ -2060,6 +2060,18 @@ Decl *ModuleFile::getDecl(DeclID DID, Optional<DeclContext *> ForcedContext) {
   return deserialized.get();
 }
 
+// Deserialization assumes a single thread, and not only because of the
+// obvious shared state here (one DeclTypeCursor per ModuleFile, the Decls
+// side table, the in-progress entries used to tie recursive references
+// back to a decl being built). Every created decl is allocated in and
+// interned through the ASTContext, whose allocator and uniquing tables are
+// unsynchronized, so two threads materializing even unrelated decl IDs
+// race inside the context long before they race in this file. Per-decl-ID
+// futures would therefore have to serialize on the context anyway and
+// would add deadlock-prone waiting for the recursive cross-references that
+// are common between "independent" decls. If a parallel frontend phase
+// ever lands, the workable shape is one importing thread feeding the
+// others, not concurrent entry into getDeclChecked.
 Expected<Decl *>
 ModuleFile::getDeclChecked(DeclID DID, Optional<DeclContext *> ForcedContext) {
   if (DID == 0)
@@ -4454,6 +4466,17 @@ Expected<Type> ModuleFile::getTypeChecked(TypeID TID) {
   return typeOrOffset;
 }
 
+// A named member lookup into a serialized context lands here and pays for
+// the whole member list, not just the name asked for. A (base type, member
+// name)-keyed on-disk table — the OnDiskIterableChainedHashTable pattern the
+// nested-type table and the Clang importer's SwiftLookupTable already use —
+// would make the probe itself cheap, but emitting it is the easy half. The
+// AST invariant is that an IterableDeclContext is either fully loaded or
+// not loaded at all; conformance checking, dynamic lookup, and derived
+// member synthesis all iterate complete member lists. Until those clients
+// can operate against name-indexed partial contexts, a per-name table would
+// sit unused, so the list stays the unit of deserialization and the
+// NumMemberListsLoaded statistic is the thing to watch.
 void ModuleFile::loadAllMembers(Decl *container, uint64_t contextData) {
   PrettyStackTraceDecl trace("loading members for", container);
   ++NumMemberListsLoaded;
@@ -322,6 +322,16 @@ static SILFunction *createBogusSILFunction(SILModule &M,
 }
 
 /// Helper function to find a SILFunction, given its name and type.
+///
+/// Resolving a reference is deliberately shallow: it probes the name table
+/// and materializes a declaration (signature only), without touching the
+/// referenced body's region of the file. Bodies are pulled in afterwards by
+/// the SIL linker's worklist, which visits a function's callees as a group
+/// — that worklist is the batching layer the reference density suggests
+/// adding here. Since the module is memory-mapped, the remaining cold-cache
+/// cost is page faults on the body offsets the worklist actually visits;
+/// issuing readahead hints for them from this lookup would guess at what
+/// the linking mode (and the deserialization state checks) will skip.
 SILFunction *SILDeserializer::getFuncForReference(StringRef name,
                                                   SILType type) {
   // Check to see if we have a function by this name already.
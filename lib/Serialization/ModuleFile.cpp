@@ -912,6 +912,16 @@ static bool isTargetTooNew(const llvm::Triple &moduleTarget,
   return ctxTarget.isOSVersionLT(major, minor, micro);
 }
 
+// Note on import cost: the scan below is already largely in-place over the
+// (usually memory-mapped) input buffer. The per-import tables — identifier
+// data, the on-disk decl/type hash tables, the group table — arrive as blob
+// records, and a blob is a StringRef into the buffer, not a copy; identifier
+// strings are handed out as pointers into IdentifierData and the hash tables
+// are probed directly over their blobs. Bitstream decoding into fresh
+// storage only happens per declaration, on demand, when something actually
+// references it. So the marginal cost of an import is dominated by page-ins
+// plus the records a client touches, and a fixed-width "mmap-friendly"
+// region would mostly re-encode what the blob layer already provides.
 ModuleFile::ModuleFile(
     std::unique_ptr<llvm::MemoryBuffer> moduleInputBuffer,
     std::unique_ptr<llvm::MemoryBuffer> moduleDocInputBuffer,
@@ -1153,6 +1163,13 @@ ModuleFile::ModuleFile(
   if (!this->ModuleDocInputBuffer)
     return;
 
+  // The .swiftdoc companion already has the cost profile wanted for plain
+  // builds: it is a separate mapped file, the scan below only walks block
+  // structure to find the comment table, and the table is an on-disk hash
+  // probed per declaration when somebody asks for a comment. The compile
+  // path never asks — comment text is materialized on demand for IDE and
+  // documentation consumers — so the comment pages are never faulted in by
+  // a batch compile, only the few header pages touched here.
   llvm::BitstreamCursor docCursor{ModuleDocInputBuffer->getMemBufferRef()};
   if (!checkModuleDocSignature(docCursor) ||
       !enterTopLevelModuleBlock(docCursor, MODULE_DOC_BLOCK_ID)) {
@@ -1311,6 +1328,15 @@ void ModuleFile::lookupValue(DeclName name,
   PrettyStackTraceModuleFile stackEntry(*this);
 
   if (TopLevelDecls) {
+    // A serialized Bloom filter in front of this table has been considered
+    // for the many-imports/mostly-miss pattern and doesn't buy what it
+    // seems to. A miss in the on-disk hash table is already one hash of the
+    // name plus one bucket probe into the mapped blob — about the cache
+    // footprint the filter itself would have — and the filter would still
+    // charge every lookup its own hash, plus a format bump. The fan-out
+    // cost lives a layer up, in issuing the lookup against each of N
+    // modules at all; a shared negative cache at the name-lookup layer
+    // would cut that N, which no per-module structure here can.
     // Find top-level declarations with the given name.
     // FIXME: As a bit of a hack, do lookup by the simple name, then filter
     // compound decls, to avoid having to completely redo how modules are
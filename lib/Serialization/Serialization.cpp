@@ -4439,6 +4439,17 @@ static void collectInterestingNestedDeclarations(
   }
 }
 
+// Emission always rewrites the file from scratch; there is no reuse of
+// blocks from a previous swiftmodule even when most inputs are unchanged.
+// That is structural, not an oversight. Decl, type, and identifier IDs are
+// assigned densely in first-use order during this very walk, so adding or
+// removing one declaration shifts the numbering inside every record that
+// follows, and the index blocks store absolute bit offsets into the decl
+// block, which move whenever anything upstream changes width. Records are
+// also bit-packed against abbreviations defined per emission, so an
+// unchanged declaration is not even guaranteed to be byte-identical across
+// runs. Splicing would need stable IDs and self-relative offsets first —
+// a format redesign, not a writer optimization.
 void Serializer::writeAST(ModuleOrSourceFile DC,
                           bool enableNestedTypeLookupTable) {
   DeclTable topLevelDecls, operatorDecls, operatorMethodDecls;
@@ -4592,6 +4603,17 @@ Serializer::Serializer(const unsigned char (&signature)[N],
 }
 
 
+// The blocks are written uncompressed, and per-block compression would cut
+// against how they are read. Lazy access works by seeking: the index blocks
+// record absolute bit offsets (SIL function bodies, decl records) and
+// readers drop a cursor directly on them from the memory-mapped buffer, so
+// a compressed SIL block would have to be inflated in full into fresh
+// memory the first time any one function is linked — exchanging page-ins of
+// the touched pages for decompressing the whole block. Consumers that never
+// read the SIL block never fault its pages in today, which is most of the
+// saving compression would chase. Shrinking what ships between build-cache
+// nodes is better done by compressing the artifacts in transport, where it
+// costs the compiler nothing.
 void Serializer::writeToStream(raw_ostream &os, ModuleOrSourceFile DC,
                                const SILModule *SILMod,
                                const SerializationOptions &options) {
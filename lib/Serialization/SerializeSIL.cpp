@@ -2143,6 +2143,19 @@ writeSILDefaultWitnessTable(const SILDefaultWitnessTable &wt) {
 }
 
 /// Helper function for whether to emit a function body.
+///
+/// Note that this is a visibility decision, not a profitability one, and a
+/// cost-model filter (emit only bodies the inliner would plausibly take)
+/// can't be layered on top. A function marked serialized is part of the
+/// module's stated interface: transparent functions must be mandatory-
+/// inlined into clients to typecheck at all, serialized bodies routinely
+/// reference other serialized shared-linkage functions that exist in no
+/// binary and so must travel with them, and generic bodies are the input
+/// for client-side specialization whose benefit is unknowable here. The
+/// size lever the frontend actually owns is which declarations get marked
+/// serializable in the first place, at their annotation site — once marked,
+/// dropping the body behind the annotation's back would break clients, not
+/// just deoptimize them.
 bool SILSerializer::shouldEmitFunctionBody(const SILFunction *F,
                                            bool isReference) {
 
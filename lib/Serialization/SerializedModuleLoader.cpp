@@ -37,6 +37,18 @@ SerializedModuleLoader::SerializedModuleLoader(ASTContext &ctx,
   : ModuleLoader(tracker), Ctx(ctx) {}
 SerializedModuleLoader::~SerializedModuleLoader() = default;
 
+// Every frontend process re-opens and re-validates the modules it imports,
+// and with many processes per build that redundancy is real. It is also
+// about as small as it can be made from this layer: getFile maps the file
+// so the bytes are shared by the OS page cache across all processes, the
+// validation pass reads only the control block, and everything expensive
+// that follows (decl materialization) lands in the per-process ASTContext.
+// A cross-process cache of ModuleFile images would have to ship that
+// derived state, but ModuleFiles are full of raw pointers into the buffer
+// and into context-allocated decls, which have no meaning in another
+// address space. Amortizing import setup across more of the build is a
+// scheduling question — fewer, larger frontend invocations — not something
+// this loader can provide by holding state for other processes.
 static std::error_code
 openModuleFiles(StringRef DirName, StringRef ModuleFilename,
                 StringRef ModuleDocFilename,
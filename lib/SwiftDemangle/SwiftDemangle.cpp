@@ -46,6 +46,39 @@ size_t swift_demangle_getDemangledName(const char *MangledName,
                                                  Length, DemangleOptions);
 }
 
+size_t swift_demangle_getDemangledNames(const char *const *MangledNames,
+                                        char *const *OutputBuffers,
+                                        const size_t *Lengths,
+                                        size_t *OutputLengths,
+                                        size_t NumNames) {
+  assert((MangledNames != nullptr || NumNames == 0) && "null input array");
+
+  swift::Demangle::DemangleOptions DemangleOptions;
+  DemangleOptions.SynthesizeSugarOnTypes = true;
+
+  // One context for the whole batch: clear() recycles the demangler's
+  // largest arena slab, so after the first few names the per-symbol
+  // allocation converges to zero.
+  swift::Demangle::Context DCtx;
+  size_t NumDemangled = 0;
+  for (size_t i = 0; i < NumNames; ++i) {
+    const char *MangledName = MangledNames[i];
+    size_t ResultLength = 0;
+    if (swift::Demangle::isSwiftSymbol(MangledName)) {
+      std::string Result = DCtx.demangleSymbolAsString(
+          llvm::StringRef(MangledName), DemangleOptions);
+      if (Result != MangledName) {
+        ResultLength = strlcpy(OutputBuffers[i], Result.c_str(), Lengths[i]);
+        ++NumDemangled;
+      }
+    }
+    if (OutputLengths)
+      OutputLengths[i] = ResultLength;
+    DCtx.clear();
+  }
+  return NumDemangled;
+}
+
 size_t swift_demangle_getSimplifiedDemangledName(const char *MangledName,
                                                  char *OutputBuffer,
                                                  size_t Length) {
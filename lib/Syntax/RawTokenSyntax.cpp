@@ -12,10 +12,147 @@
 
 
 #include "swift/Syntax/TokenSyntax.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Mutex.h"
 
 using namespace swift;
 using namespace swift::syntax;
 
+namespace {
+
+/// A cache of interned token nodes.
+///
+/// Token nodes are immutable and their reference counting is thread-safe, so
+/// all requests for an identical token can share one node.  Interned nodes
+/// outlive the source buffer they were lexed from, so the token text is
+/// copied into the node, and tokens whose trivia carries borrowed text
+/// (comments and garbage) are never interned.
+class TokenInterner {
+  /// Interned nodes, keyed by a hash of kind, text, presence, and trivia.
+  /// Collisions are resolved by exact comparison in \c matches.
+  llvm::DenseMap<llvm::hash_code, llvm::SmallVector<RC<RawTokenSyntax>, 2>>
+      Cache;
+  llvm::sys::Mutex CacheMutex;
+  unsigned NumCachedTokens = 0;
+
+  /// Start over if an adversarial buffer produces too many distinct tokens;
+  /// the cache exists to bound memory, not to grow it.
+  enum : unsigned { MaxCachedTokens = 8192 };
+
+  static bool matchesTrivia(const Trivia &Pieces, const Trivia &Others) {
+    if (Pieces.Pieces.size() != Others.Pieces.size())
+      return false;
+    auto O = Others.begin();
+    for (const auto &Piece : Pieces) {
+      if (Piece.Kind != O->Kind || Piece.Count != O->Count ||
+          Piece.Text.str() != O->Text.str())
+        return false;
+      ++O;
+    }
+    return true;
+  }
+
+  static bool matches(const RawTokenSyntax &Tok, tok TokenKind,
+                      OwnedString Text, SourcePresence Presence,
+                      const Trivia &LeadingTrivia,
+                      const Trivia &TrailingTrivia) {
+    return Tok.TokenKind == TokenKind && Tok.Presence == Presence &&
+           Tok.Text.str() == Text.str() &&
+           matchesTrivia(Tok.LeadingTrivia, LeadingTrivia) &&
+           matchesTrivia(Tok.TrailingTrivia, TrailingTrivia);
+  }
+
+  static llvm::hash_code hashToken(tok TokenKind, OwnedString Text,
+                                   SourcePresence Presence,
+                                   const Trivia &LeadingTrivia,
+                                   const Trivia &TrailingTrivia) {
+    auto Code = llvm::hash_combine(unsigned(TokenKind), Text.str(),
+                                   unsigned(Presence));
+    for (const auto &Piece : LeadingTrivia)
+      Code = llvm::hash_combine(Code, unsigned(Piece.Kind), Piece.Count,
+                                Piece.Text.str());
+    // Keep a leading piece from hashing like the same piece trailing.
+    Code = llvm::hash_combine(Code, ~0U);
+    for (const auto &Piece : TrailingTrivia)
+      Code = llvm::hash_combine(Code, unsigned(Piece.Kind), Piece.Count,
+                                Piece.Text.str());
+    return Code;
+  }
+
+public:
+  RC<RawTokenSyntax> intern(tok TokenKind, OwnedString Text,
+                            SourcePresence Presence,
+                            const Trivia &LeadingTrivia,
+                            const Trivia &TrailingTrivia,
+                            RC<RawTokenSyntax> (*create)(
+                                tok, OwnedString, SourcePresence,
+                                const Trivia &, const Trivia &)) {
+    auto Code =
+        hashToken(TokenKind, Text, Presence, LeadingTrivia, TrailingTrivia);
+
+    llvm::sys::ScopedLock Lock(CacheMutex);
+    auto &Bucket = Cache[Code];
+    for (const auto &Cached : Bucket)
+      if (matches(*Cached, TokenKind, Text, Presence, LeadingTrivia,
+                  TrailingTrivia))
+        return Cached;
+
+    if (NumCachedTokens >= MaxCachedTokens) {
+      Cache.clear();
+      NumCachedTokens = 0;
+    }
+
+    // Copy the text so that the interned node does not borrow storage from
+    // the source buffer.
+    auto Tok = create(TokenKind, Text.copy(), Presence, LeadingTrivia,
+                      TrailingTrivia);
+    Cache[Code].push_back(Tok);
+    ++NumCachedTokens;
+    return Tok;
+  }
+};
+
+/// Checks whether a token may be interned.  Interned nodes outlive the source
+/// buffer, so all of the trivia text (comments and garbage) must be empty
+/// since it may be borrowed; the token text itself is copied.
+bool isInternableToken(const Trivia &LeadingTrivia,
+                       const Trivia &TrailingTrivia) {
+  auto hasNoText = [](const Trivia &T) {
+    for (const auto &Piece : T)
+      if (!Piece.Text.empty())
+        return false;
+    return true;
+  };
+  return hasNoText(LeadingTrivia) && hasNoText(TrailingTrivia);
+}
+
+} // unnamed namespace
+
+RC<RawTokenSyntax> RawTokenSyntax::make(tok TokenKind, OwnedString Text,
+                                        const SourcePresence Presence,
+                                        const Trivia &LeadingTrivia,
+                                        const Trivia &TrailingTrivia) {
+  auto create = [](tok TokenKind, OwnedString Text, SourcePresence Presence,
+                   const Trivia &LeadingTrivia,
+                   const Trivia &TrailingTrivia) -> RC<RawTokenSyntax> {
+    return RC<RawTokenSyntax> {
+      new RawTokenSyntax {
+        TokenKind, Text, Presence,
+        LeadingTrivia, TrailingTrivia
+      }
+    };
+  };
+
+  if (!isInternableToken(LeadingTrivia, TrailingTrivia))
+    return create(TokenKind, Text, Presence, LeadingTrivia, TrailingTrivia);
+
+  static TokenInterner Interner;
+  return Interner.intern(TokenKind, Text, Presence, LeadingTrivia,
+                         TrailingTrivia, create);
+}
+
 RawTokenSyntax::RawTokenSyntax()
   : RawSyntax(SyntaxKind::Token, {}, SourcePresence::Missing),
     TokenKind(tok::NUM_TOKENS), Text(OwnedString()),
@@ -0,0 +1,90 @@
+//===--- SyntaxParsingCache.cpp - Incremental syntax tree reuse -----------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Syntax/SyntaxParsingCache.h"
+#include "swift/Syntax/RawTokenSyntax.h"
+
+using namespace swift;
+using namespace swift::syntax;
+
+using llvm::dyn_cast;
+
+size_t SyntaxParsingCache::getFullWidth(const RC<RawSyntax> &Node) {
+  if (auto Tok = dyn_cast<RawTokenSyntax>(Node.get())) {
+    size_t Width = Tok->LeadingTrivia.getTextLength();
+    if (!Tok->isMissing())
+      Width += Tok->getText().size();
+    Width += Tok->TrailingTrivia.getTextLength();
+    return Width;
+  }
+
+  size_t Width = 0;
+  for (const auto &Child : Node->Layout)
+    Width += getFullWidth(Child);
+  return Width;
+}
+
+llvm::Optional<size_t>
+SyntaxParsingCache::translateToPreEditPosition(size_t NewPosition) const {
+  size_t Position = NewPosition;
+  for (const auto &Edit : Edits) {
+    if (Edit.Start > Position)
+      break;
+    if (Position < Edit.Start + Edit.ReplacementLength)
+      return llvm::None;
+    Position = Position - Edit.ReplacementLength + Edit.originalLength();
+  }
+  return Position;
+}
+
+bool SyntaxParsingCache::nodeCanBeReused(const RC<RawSyntax> &Node,
+                                         size_t NodeStart,
+                                         SyntaxKind Kind) const {
+  if (Node->Kind != Kind)
+    return false;
+
+  // A node that touches an edit cannot be reused: the lexer may have joined
+  // or split tokens at the edit boundary, so being adjacent to a damaged
+  // region is as bad as overlapping it.
+  size_t NodeEnd = NodeStart + getFullWidth(Node);
+  for (const auto &Edit : Edits)
+    if (Edit.intersectsOrTouchesRange(NodeStart, NodeEnd))
+      return false;
+
+  return true;
+}
+
+RC<RawSyntax> SyntaxParsingCache::lookUpFrom(const RC<RawSyntax> &Node,
+                                             size_t NodeStart, size_t Position,
+                                             SyntaxKind Kind) const {
+  if (NodeStart == Position && nodeCanBeReused(Node, NodeStart, Kind))
+    return Node;
+
+  // Descend into the child that covers the requested position.
+  size_t ChildStart = NodeStart;
+  for (const auto &Child : Node->Layout) {
+    size_t ChildEnd = ChildStart + getFullWidth(Child);
+    if (ChildStart <= Position && Position < ChildEnd)
+      return lookUpFrom(Child, ChildStart, Position, Kind);
+    ChildStart = ChildEnd;
+  }
+  return nullptr;
+}
+
+RC<RawSyntax> SyntaxParsingCache::lookUp(size_t NewPosition,
+                                         SyntaxKind Kind) const {
+  auto OldPosition = translateToPreEditPosition(NewPosition);
+  if (!OldPosition.hasValue())
+    return nullptr;
+
+  return lookUpFrom(OldSyntaxTree, /*NodeStart=*/0, *OldPosition, Kind);
+}
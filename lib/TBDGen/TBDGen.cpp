@@ -326,6 +326,16 @@ void TBDGenVisitor::visitProtocolDecl(ProtocolDecl *PD) {
 #endif
 }
 
+// The walk below is already file-at-a-time, so a per-file symbol cache with
+// a cheap merge is structurally easy — the hard part is the cache key. A
+// source file's interface hash only covers its tokens; the emitted symbol
+// set also shifts with linkage-relevant invocation state (-enable-testing,
+// WMO vs. multi-file, witness-table serialization, compiler version), all
+// threaded through UniversalLinkageInfo here, so a sound key is the hash
+// plus that whole configuration. Measure first, though: the visitor never
+// looks inside bodies, so its cost is a mangling pass over public decls —
+// the fixed cost attributed to TBD generation is mostly the frontend job
+// around it, which caching inside this routine would not remove.
 static void enumeratePublicSymbolsAndWrite(ModuleDecl *M, FileUnit *singleFile,
                                            StringSet &symbols,
                                            bool hasMultipleIRGenThreads,
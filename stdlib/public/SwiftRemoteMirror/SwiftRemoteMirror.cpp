@@ -13,6 +13,7 @@
 #include "swift/Reflection/ReflectionContext.h"
 #include "swift/Reflection/TypeLowering.h"
 #include "swift/Remote/CMemoryReader.h"
+#include "swift/Remote/CachingMemoryReader.h"
 #include "swift/Runtime/Unreachable.h"
 #include "swift/SwiftRemoteMirror/SwiftRemoteMirror.h"
 
@@ -44,7 +45,12 @@ swift_reflection_createReflectionContext(void *ReaderContext,
     getSymbolAddress
   };
 
-  auto Reader = std::make_shared<CMemoryReader>(ReaderImpl);
+  // Clients drive this interface against a stopped process or a core file,
+  // so reads can be cached at page granularity for the duration of the
+  // context; MetadataReader's pointer chasing otherwise costs one callback
+  // per field.
+  auto Reader = std::make_shared<CachingMemoryReader>(
+      std::make_shared<CMemoryReader>(ReaderImpl));
   auto Context
     = new swift::reflection::ReflectionContext<External<RuntimeTarget<sizeof(uintptr_t)>>>(Reader);
   return reinterpret_cast<SwiftReflectionContextRef>(Context);
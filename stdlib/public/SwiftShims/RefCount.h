@@ -119,6 +119,18 @@ typedef struct {
   Downside: this code is a bit twisted.
   Upside: this code has less duplication than it might otherwise
 
+  On biased (thread-confined) reference counting: making objects born
+  owner-biased and counted non-atomically until another thread touches them
+  has been proposed, with unbiasing deferred to the side-table mechanism.
+  The blocking problem is detection, not storage. Every retain/release from
+  a non-owning thread would first have to discover the bias — an extra
+  owner-thread-ID load and compare on the fast path every operation pays —
+  and revoking a bias safely requires stopping or signalling the owner,
+  since the owner's non-atomic updates are invisible to a CAS. The flags
+  bits could represent the biased state, and gaining a side table is
+  already a one-way operation a revocation could piggyback on, but without
+  a cheap revocation story the scheme taxes the shared-object majority of
+  real programs to speed up the confined ones.
 
   Object lifecycle state machine:
 
@@ -2385,7 +2385,20 @@ static bool _dynamicCastTupleToTuple(OpaqueValue *destination,
 /******************************************************************************/
 
 /// Perform a dynamic cast to an arbitrary type.
-
+///
+/// A (srcType, targetType) memoization table in front of this function has
+/// been suggested, in the style of method-cache lookups. It doesn't fit the
+/// semantics: the outcome is not a function of the static metadata pair.
+/// Class casts depend on the instance's dynamic isa, existential sources on
+/// the dynamic type inside the container, and bridging paths on the value
+/// itself (and on flags, which also select take/copy and destroy behavior) —
+/// so the key would have to include dynamic state that costs as much to
+/// extract as the dispatch below. The sub-checks that *are* pure pair
+/// predicates already have caches: protocol lookups go through the global
+/// conformance cache, and the class-to-class walk is a short superclass
+/// chase with no allocation. Repeated identical casts mostly pay the
+/// structural dispatch here, which a cache keyed usefully enough would
+/// largely re-create.
 bool swift::swift_dynamicCast(OpaqueValue *dest, OpaqueValue *src,
                               const Metadata *srcType,
                               const Metadata *targetType,
@@ -30,6 +30,18 @@ Demangle::NodePointer
 swift::_swift_buildDemanglingForMetadata(const Metadata *type,
                                          Demangle::Demangler &Dem);
 
+// On demangler allocation traffic: every runtime entry point that needs a
+// node tree constructs a fresh Demangler, so each call mallocs at least one
+// NodeFactory slab. The factory is already built for reuse — clear() keeps
+// the largest slab, so a long-lived Demangler converges to zero allocation
+// per cycle — which makes a thread-local retained instance the natural fix
+// for demangle-heavy bursts. Two things have kept it out so far: the
+// runtime's TLS portability baggage (see Exclusivity.cpp for what that
+// costs), and the fact that repeated *names* are already absorbed above
+// this layer — by-name metadata lookups memoize their results, so steady
+// state re-demangles only novel names. Burst-phase startup is the only
+// workload the TLS arena would visibly improve.
+
 // Build a demangled type tree for a nominal type.
 static Demangle::NodePointer
 _buildDemanglingForNominalType(const Metadata *type, Demangle::Demangler &Dem) {
@@ -154,6 +154,18 @@ void swift::dumpStackTraceEntry(unsigned index, void *framePC,
 #endif
 }
 
+// A cached symbol-range table (built once from the loaded images, binary
+// searched per frame) has been suggested to speed this up. It would not pay
+// for itself: every caller of these paths aborts the process right after
+// reporting, so each fatal error is both the first and the last use of any
+// per-process cache. ImageInspection also only hands us the swift metadata
+// sections, not symbol tables, so building the table means re-parsing each
+// image's symtab — the work dladdr already does per query — inside a process
+// that is in the middle of dying. The per-frame cost that actually shows up
+// is demangling, bounded by the 128-frame cap; supervisors that need faster
+// restarts should symbolicate offline, which the <unavailable> path supports
+// by printing image-relative offsets precisely so the trace can be
+// reconstructed after the process is gone.
 LLVM_ATTRIBUTE_NOINLINE
 void swift::printCurrentBacktrace(unsigned framesToSkip) {
 #if SWIFT_SUPPORTS_BACKTRACE_REPORTING
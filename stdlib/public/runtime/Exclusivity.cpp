@@ -173,6 +173,17 @@ static_assert(sizeof(Access) <= sizeof(ValueBuffer) &&
               "Access doesn't fit in a value buffer!");
 
 /// A set of accesses that we're tracking.  Just a singly-linked list.
+///
+/// The list shape is forced by the storage model: each Access lives inside
+/// the ValueBuffer the caller materialized for its begin/end scope, so the
+/// set threads through memory it doesn't own and entries leave in whatever
+/// order scopes unwind. Replacing the walk with a flat vector-scannable
+/// array of (pointer, action) pairs means maintaining that array as a
+/// *mirror* of the records — insert appends, remove must find and compact —
+/// plus an overflow path, all to speed a loop that visits a handful of
+/// nodes when exclusivity stacks are shallow. If profiles show deep sets,
+/// mirror-array-first is the right structure; measure the depth
+/// distribution before paying the bookkeeping on every begin/end.
 class AccessSet {
   Access *Head = nullptr;
 public:
@@ -22,6 +22,17 @@
 
 using namespace swift;
 
+// Swift deliberately sits on the system allocator rather than running its
+// own size-classed magazines, even though swift_deallocObject receives the
+// allocation size statically and could skip malloc's size metadata. The
+// interop constraints drive this: Objective-C code frees bridged Swift
+// objects (and vice versa) straight through the system malloc zone, tools
+// like leaks and malloc history only understand registered zones, and a
+// private per-thread cache would double every thread's allocator footprint
+// next to the libmalloc magazines already in the process. On platforms
+// where this matters, the size/alignMask arguments exist precisely so a
+// zone that exploits them (e.g. a future swift_zone or malloc_type hook)
+// can slot in here without touching callers.
 void *swift::swift_slowAlloc(size_t size, size_t alignMask)
     SWIFT_CC(RegisterPreservingCC_IMPL) {
   // FIXME: use posix_memalign if alignMask is larger than the system guarantee.
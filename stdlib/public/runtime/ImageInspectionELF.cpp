@@ -61,6 +61,17 @@ static InspectArgs TypeMetadataRecordArgs = {
 };
 
 
+// This file only discovers section boundaries; each image is visited once,
+// at startup via dl_iterate_phdr or at dlopen time via the hook, and handed
+// to the registration callbacks as a raw (start, size) block. Preprocessing
+// the blocks here into sorted or indexed form would be wasted motion: the
+// consumers key their caches by type descriptor or metadata pointer, not by
+// anything sortable at registration time, and the cost profile of a
+// cold-start resolution storm is first-touch scans plus misses — both
+// already bounded on the consumer side, where successful and failed
+// lookups are cached and failures are re-validated only when the section
+// count grows (i.e. after another image actually loads).
+//
 // Extract the section information for a named section in an image. imageName
 // can be nullptr to specify the main executable.
 static SectionInfo getSectionInfo(const char *imageName,
@@ -281,6 +281,19 @@ public:
 
   /// Look up a cached metadata entry. If a cache match exists, return it.
   /// Otherwise, call entryBuilder() and add that to the cache.
+  ///
+  /// Reads of fully-initialized entries are already lock-free: the map probe
+  /// never takes the mutex, and getValue() is a single load-acquire. The
+  /// ConcurrencyControl lock and queue exist only to park threads behind an
+  /// entry that is still being instantiated. What a flat wait-free hash
+  /// probe would actually buy is removing the concurrent tree's dependent
+  /// loads (one pointer chase per level). Swapping the tree for an
+  /// open-addressed table is not a local change, though: entries are
+  /// variable-sized (key data is tail-allocated), their addresses must stay
+  /// stable forever because metadata pointers escape, and the map's nodes
+  /// come from the never-freed MetadataAllocator — so a resizable table
+  /// would have to hold pointers to the same stable entries and republish
+  /// itself on growth without blocking readers.
   const ValueTy *findOrAdd(const void * const *arguments, size_t numArguments,
                            llvm::function_ref<ValueTy *()> builder) {
 
@@ -166,6 +166,18 @@ swift::_matchMetadataByMangledTypeName(const llvm::StringRef typeName,
 }
 
 // returns the type metadata for the type named by typeName
+//
+// Successful lookups are memoized in TypeMetadataState::Cache, so only the
+// first query for a name pays this scan. The two remaining linear costs are
+// first-time hits and, worse, misses: a name that resolves to nothing is
+// rescanned against every section on every query, because the cache has no
+// negative entries. Fixing that is the higher-value change and needs the
+// same generation scheme the conformance cache uses — a failure entry is
+// only valid while SectionsToScan.size() is unchanged, since a later dlopen
+// can introduce the type. A lazily-built per-section name index would also
+// help first hits, but note it can't be cheaper than one full scan per
+// section: record names come from matching against mangled names, so
+// building the index does the work this loop does once.
 static const Metadata *
 _searchTypeMetadataRecords(const TypeMetadataState &T,
                            const llvm::StringRef typeName) {
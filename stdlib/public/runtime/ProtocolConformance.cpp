@@ -323,6 +323,17 @@ struct ConformanceCacheResult {
 };
 
 /// Search for a witness table in the ConformanceCache.
+///
+/// This global map is the only cache level; repeated checks of the same
+/// (type, protocol) pair from many threads all land on it. A per-metadata
+/// inline cache in front of it is not retrofittable: most metadata is
+/// compiler-emitted constant data in read-only pages, and metadata layout is
+/// ABI, so there is no writable slot to put one in. A workable front cache
+/// would be per-thread instead — successful entries are safe to replicate
+/// since a found conformance never changes, while negative entries must stay
+/// here because they are invalidated by generation when new conformance
+/// sections are loaded. Any such cache needs the same TLS portability
+/// handling Exclusivity.cpp already carries.
 static
 ConformanceCacheResult
 searchInConformanceCache(const Metadata *type,
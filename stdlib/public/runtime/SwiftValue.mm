@@ -174,6 +174,20 @@ swift::getValueFromSwiftValue(_SwiftValue *v) {
   return {instanceType, getSwiftValuePayload(v, alignMask)};
 }
 
+// Interning boxes for frequently-bridged payloads (in the spirit of
+// NSNumber's tagged values) keeps coming up as a way to cut this allocation.
+// It doesn't fit what _SwiftValue is. The values that make good interning
+// candidates — small integers, common strings, bool — never get here at all:
+// they bridge to Foundation types with tagged-pointer representations. What
+// does land here is arbitrary value types with no Cocoa bridge, and deciding
+// that two such values are "the same" requires an Equatable conformance
+// lookup and a value-witness comparison per event, which costs on the order
+// of the allocation being saved. The box is also a full ObjC object with
+// observable identity: clients can hang associated objects off it or compare
+// it by pointer, so handing the same instance to unrelated bridging events
+// is a semantic change, and a cache that isn't immortal would need eviction
+// synchronized against in-flight releases on what is currently a lock-free
+// path.
 _SwiftValue *swift::bridgeAnythingToSwiftValueObject(OpaqueValue *src,
                                                     const Metadata *srcType,
                                                     bool consume) {
@@ -222,6 +222,14 @@ class WeakReference {
     destroyOldNativeBits(oldBits);
   }
 
+  // Loading a live object takes no lock anywhere on this path: the
+  // reference holds a side-table pointer that stays valid for the
+  // reference's whole lifetime (the weak RC keeps the entry alive even
+  // after the object dies), and tryRetain is a compare-exchange on the
+  // side table's refcount bits that fails cleanly once deiniting has
+  // begun. Contention between many readers is the cache line holding
+  // those bits, not a mutex — there is no epoch scheme to add because
+  // there is no lock to avoid.
   HeapObject *nativeLoadStrong() {
     auto bits = nativeValue.load(std::memory_order_relaxed);
     return nativeLoadStrongFromBits(bits);
@@ -0,0 +1,13 @@
+@_transparent
+public func transparentOther(_ x: Int) -> Int {
+  return x &+ 1
+}
+
+@inline(__always)
+public func alwaysInlineOther(_ x: Int) -> Int {
+  return x &* 2
+}
+
+public func plainOther(_ x: Int) -> Int {
+  return x - 1
+}
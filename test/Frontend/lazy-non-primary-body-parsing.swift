@@ -0,0 +1,11 @@
+// RUN: %target-swift-frontend -typecheck -verify -primary-file %s %S/Inputs/lazy_transparent_other.swift -lazy-non-primary-body-parsing
+// RUN: %target-swift-frontend -emit-sil -o /dev/null -primary-file %s %S/Inputs/lazy_transparent_other.swift -lazy-non-primary-body-parsing
+
+// The non-primary file's function bodies are recorded as token ranges during
+// parsing; the transparent and @inline(__always) ones must be materialized
+// again before this primary is type-checked, since SILGen may demand them
+// for mandatory inlining of the calls below.
+
+func caller(_ x: Int) -> Int {
+  return transparentOther(x) + alwaysInlineOther(x) + plainOther(x)
+}
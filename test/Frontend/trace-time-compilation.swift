@@ -0,0 +1,13 @@
+// RUN: %empty-directory(%t)
+// RUN: %target-swift-frontend -typecheck -trace-time-compilation %t/trace.json %s
+// RUN: %FileCheck %s < %t/trace.json
+
+// Each phase timer records a begin and an end event in the chrome://tracing
+// JSON array format.
+
+// CHECK: [
+// CHECK: {"name": "{{[^"]+}}", "ph": "B", "ts": {{[0-9]+}}, "pid": 1, "tid": {{[0-9]+}}}
+// CHECK: "ph": "E"
+// CHECK: ]
+
+func f() -> Int { return 42 }
@@ -0,0 +1,11 @@
+struct OtherStruct {
+  var value = 0
+}
+
+#if swift(>=100)
+inactive tokens skipped inside a diagnostic transaction
+#endif
+
+func otherDiagnosed() {
+  let unused = 3 // expected-warning {{initialization of immutable value 'unused' was never used}}
+}
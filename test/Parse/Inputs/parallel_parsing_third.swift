@@ -0,0 +1,8 @@
+enum ThirdEnum {
+  case third
+  case other
+}
+
+#if swift(>=100)
+more tokens that are only ever skipped
+#endif
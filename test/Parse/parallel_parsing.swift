@@ -0,0 +1,13 @@
+// RUN: %target-swift-frontend -typecheck -verify -enable-parallel-parsing %s %S/Inputs/parallel_parsing_other.swift %S/Inputs/parallel_parsing_third.swift
+
+// The other files are parsed on worker threads; this checks that their
+// declarations land in the module, that inactive #if skipping (which opens a
+// diagnostic transaction) is safe off the main thread, and that diagnostics
+// from all files still verify.
+
+func useOther() -> OtherStruct { return OtherStruct() }
+func useThird() -> ThirdEnum { return .third }
+
+#if swift(>=100)
+these tokens are never parsed
+#endif
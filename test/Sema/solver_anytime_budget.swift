@@ -0,0 +1,15 @@
+// RUN: %target-swift-frontend -typecheck -verify -solver-anytime-budget=10000 %s
+// RUN: not %target-swift-frontend -typecheck -solver-anytime-budget=abc %s 2>&1 | %FileCheck %s
+
+// CHECK: invalid value 'abc' in '-solver-anytime-budget=abc'
+
+// With a generous budget the solver behaves exactly as without one: these
+// expressions have unique solutions and must type-check cleanly.
+
+func mixed(_ x: Double, _ n: Int) -> Double {
+  let a = 1 + 2 * 3 - 4 / 2 + Double(n) * 0.5
+  let b = x * x + 2.0 * x + 1.0 - a / (x + 1.0)
+  return a + b
+}
+
+let folded = [1 + 2, 2 * 3, 4 - 1].map { $0 * 2 }.reduce(0) { $0 + $1 }
@@ -0,0 +1,76 @@
+// RUN: %target-swift-frontend -typecheck -verify %s
+
+// Regression tests for conformance inheritance through the superclass
+// expansion path in ConformanceLookupTable: the superclass table is only
+// expanded (not resolved) when a subclass inherits its conformances, so
+// precedence between inherited, implied, and explicit entries must come out
+// the same regardless of which entries resolution would have pruned on the
+// superclass side.
+
+protocol P1 { }
+protocol P2 : P1 { }
+protocol P3 : P2 { }
+protocol P4 : P3 { }
+
+// ---------------------------------------------------------------------------
+// Redeclaring a conformance the superclass holds explicitly
+// ---------------------------------------------------------------------------
+
+class ExplicitBase : P1 { }
+
+class ExplicitDerived : ExplicitBase { } // expected-note{{'ExplicitDerived' inherits conformance to protocol 'P1' from superclass here}}
+
+extension ExplicitDerived : P1 { } // expected-error{{redundant conformance of 'ExplicitDerived' to protocol 'P1'}}
+
+// ---------------------------------------------------------------------------
+// Redeclaring a conformance the superclass holds only as an implied entry
+// ---------------------------------------------------------------------------
+
+class ImpliedBase : P3 { }
+
+class ImpliedDerived : ImpliedBase { } // expected-note{{'ImpliedDerived' inherits conformance to protocol 'P1' from superclass here}}
+
+extension ImpliedDerived : P1 { } // expected-error{{redundant conformance of 'ImpliedDerived' to protocol 'P1'}}
+
+// A refinement that only adds new conformances is fine; everything it
+// implies that the superclass already has is superseded silently.
+class RefiningDerived : ImpliedBase { }
+extension RefiningDerived : P4 { } // okay, introduces P4; P1...P3 inherited
+
+// ---------------------------------------------------------------------------
+// Conformances entering through a superclass extension
+// ---------------------------------------------------------------------------
+
+class ExtensionBase { }
+extension ExtensionBase : P2 { }
+
+class ExtensionDerived : ExtensionBase { } // expected-note{{'ExtensionDerived' inherits conformance to protocol 'P1' from superclass here}}
+
+extension ExtensionDerived : P1 { } // expected-error{{redundant conformance of 'ExtensionDerived' to protocol 'P1'}}
+
+// ---------------------------------------------------------------------------
+// Conformances inherited across multiple levels
+// ---------------------------------------------------------------------------
+
+class Grandparent : P3 { }
+class Parent : Grandparent { }
+
+class Grandchild : Parent { } // expected-note{{'Grandchild' inherits conformance to protocol 'P2' from superclass here}}
+
+extension Grandchild : P2 { } // expected-error{{redundant conformance of 'Grandchild' to protocol 'P2'}}
+
+// ---------------------------------------------------------------------------
+// Inherited conformances are usable without any redeclaration
+// ---------------------------------------------------------------------------
+
+func requiresP1<T : P1>(_: T) { }
+func requiresP3<T : P3>(_: T) { }
+
+func useInherited(_ base: ImpliedBase, _ derived: RefiningDerived,
+                  _ grandchild: Grandchild) {
+  requiresP1(base)
+  requiresP1(derived)
+  requiresP3(derived)
+  requiresP1(grandchild)
+  requiresP3(grandchild)
+}
@@ -316,6 +316,16 @@ struct SwiftASTManager::Implementation {
   Cache<ASTKey, ASTProducerRef> ASTCache{ "sourcekit.swift.ASTCache" };
   llvm::sys::Mutex CacheMtx;
 
+  // A single serial queue orders all AST builds, so a slow background
+  // build can delay an interactive one behind it. Consumers that arrive
+  // while a build is in flight do piggyback on its result (see
+  // popQueuedConsumers), which absorbs the common stale-then-fresh
+  // completion pattern against the same document state. Real priority
+  // scheduling needs more than a second queue: builds for the same
+  // invocation must stay serialized (they share the ASTProducer), and
+  // preempting an in-flight build is not possible because type checking
+  // has no cancellation points — a cancelled request can only be dropped
+  // before its build starts or have its consumer detached after.
   WorkQueue ASTBuildQueue{ WorkQueue::Dequeuing::Serial,
                            "sourcekit.swift.ASTBuilding" };
 
@@ -646,6 +656,18 @@ std::vector<SwiftASTConsumerRef> ASTProducer::popQueuedConsumers() {
   return Consumers;
 }
 
+// Any input change rebuilds the whole AST from scratch. Invalidation at
+// function-body granularity — re-checking only the edited body after a
+// keystroke — is the obvious want, but the compiler offers no unit of
+// undo: the ASTContext grows monotonically with no way to evict the decls,
+// types, and conformances a previous check created, and delayed body
+// parsing (PersistentParserState) only lets a body be parsed *late*, not
+// re-parsed after its context has been mutated. Code completion gets away
+// with a body-sized second pass because it throws that instance away;
+// a persistent session would accumulate every stale generation. Until the
+// ASTContext supports eviction, snapshot-level rebuild is the correct
+// invalidation unit, and the cache above keeps it to one rebuild per edit
+// rather than one per request.
 bool ASTProducer::shouldRebuild(SwiftASTManager::Implementation &MgrImpl,
                                 ArrayRef<ImmutableTextSnapshotRef> Snapshots) {
   const SwiftInvocation::Implementation &Invok = InvokRef->Impl;
@@ -690,6 +690,24 @@ getParamParentNameOffset(const ValueDecl *VD, SourceLoc Cursor) {
 }
 
 /// Returns true for failure to resolve.
+///
+/// On caching this work keyed by USR: the payload built here is not a pure
+/// function of the symbol. The printed type is the type at the use site
+/// (generic parameters substituted at a reference), the available
+/// refactorings depend on the token and its SourceFile, ParentNameOffset
+/// depends on the cursor location, and DeclarationLoc is remapped against
+/// the caller's snapshots. Only the decl-derived slices — USR, doc comment
+/// XML, annotated declarations, related decls — are reusable, and those are
+/// keyed by the AST the ValueDecl pointer came from, not by the USR alone:
+/// the same USR renders differently across rebuilds once an edit changes
+/// the decl or anything it prints (there is no finer-grained interface
+/// generation to key on; ASTProducer rebuilds are the invalidation unit).
+/// A cache would also need an owning representation for the result: the
+/// strings passed to the receiver below are StringRefs into a stack buffer
+/// that dies when this function returns. None of that is impossible, but
+/// the win is bounded — the expensive part of a repeated cursor-info
+/// request is getting an up-to-date AST, which SwiftASTManager's cache
+/// already amortizes, not this rendering pass.
 static bool passCursorInfoForDecl(SourceFile* SF,
                                   const ValueDecl *VD,
                                   const ModuleDecl *MainModule,
@@ -166,6 +166,21 @@ static bool stringInSortedArray(
   return !cmp(str, *iter);
 }
 
+// Why there is no "extract each listed function into its own .sil file"
+// batch mode: extraction is destructive. We keep the requested functions,
+// gut everything else down to external declarations, and let dead-function
+// elimination sweep the rest — that is also what makes the output
+// self-contained enough to reparse (the AST and referenced declarations
+// survive alongside the kept bodies). After one extraction the module is
+// consumed, and SILModule has no clone operation to snapshot it per listed
+// function. Amortizing the expensive part of a corpus build across one
+// process therefore means re-running setup/sema/deserialization per output
+// inside a loop, which saves only process startup — the honest way to get
+// a corpus refresh into minutes is to run these invocations concurrently
+// from the build script, one process per function, which needs no changes
+// here. A real batch mode wants either a SILModule deep-copy or a
+// non-destructive printer that can close over a function's references;
+// neither exists yet.
 void removeUnwantedFunctions(SILModule *M, ArrayRef<std::string> MangledNames,
                              ArrayRef<std::string> DemangledNames) {
   assert((!MangledNames.empty() || !DemangledNames.empty()) &&
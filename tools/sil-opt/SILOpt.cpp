@@ -133,6 +133,17 @@ Passes(llvm::cl::desc("Passes:"),
 #include "swift/SILOptimizer/PassManager/Passes.def"
        clEnumValN(0, "", "")));
 
+// Strictly speaking not a "pass": executes the pipelines described in a yaml
+// file, in the format produced by SILPassPipelinePlan::print() and
+// sil-passpipeline-dumper. Together they allow a pipeline from a real
+// frontend run to be replayed (or truncated and replayed, e.g. when
+// bisecting for the pass that introduced a regression) over a .sil file.
+static llvm::cl::opt<std::string>
+ExternalPassPipelineFilename(
+    "external-pass-pipeline-filename",
+    llvm::cl::desc("Run the passes in the pass pipeline description file "
+                   "instead of a predefined optimization group"));
+
 static llvm::cl::opt<bool>
 PrintStats("print-stats", llvm::cl::desc("Print various statistics"));
 
@@ -389,7 +400,10 @@ int main(int argc, char **argv) {
   if (VerifyMode)
     enableDiagnosticVerifier(CI.getSourceMgr());
 
-  if (OptimizationGroup == OptGroup::Diagnostics) {
+  if (!ExternalPassPipelineFilename.empty()) {
+    runSILOptimizationPassesWithFileSpecification(*CI.getSILModule(),
+                                                  ExternalPassPipelineFilename);
+  } else if (OptimizationGroup == OptGroup::Diagnostics) {
     runSILDiagnosticPasses(*CI.getSILModule());
   } else if (OptimizationGroup == OptGroup::Performance) {
     runSILOptPreparePasses(*CI.getSILModule());
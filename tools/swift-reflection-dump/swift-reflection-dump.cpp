@@ -135,6 +135,16 @@ static ReflectionInfo findReflectionInfo(const ObjectFile *objectFile) {
   };
 }
 
+// All input binaries feed one TypeRefBuilder before anything is printed,
+// because typerefs in one image can reference types whose descriptors live
+// in another, and the builder's interning assumes a single node pool — so
+// parallelism across sections or inputs inside one invocation would be
+// threading a structure built to be shared. For a many-binary fleet job,
+// run one process per binary instead: invocations are independent, the
+// expensive state is per-binary section parsing with nothing to share, and
+// the text output streams as it is produced. A compact binary output mode
+// belongs in the downstream size-analysis tool's parser, not here; this
+// dump is also a debugging surface and its format is eyeballed.
 static int doDumpReflectionSections(ArrayRef<std::string> binaryFilenames,
                                     StringRef arch,
                                     ActionType action,
@@ -138,3 +138,36 @@ TEST(TreeScopedHashTableTest, IteratorTest) {
   delete S1;
 }
 
+TEST(TreeScopedHashTableTest, DetachedScopeShadowing) {
+  using HashtableTy = TreeScopedHashTable<unsigned, unsigned>;
+  using ScopeTy = HashtableTy::ScopeTy;
+  HashtableTy HT;
+
+  auto S1 = new ScopeTy(HT, 0);
+  HT.insertIntoScope(*S1, 1, 1001);
+
+  auto S2 = new ScopeTy(HT, S1);
+  HT.insertIntoScope(*S2, 2, 2002);
+  auto DS = S2->detach();
+  delete S2;
+
+  // The detached scope owns its entries, but they are not visible from the
+  // parent scope.
+  EXPECT_EQ(0U, HT.lookup(*S1, 2));
+
+  // The parent scope may define a key that a dormant detached scope also
+  // holds.
+  HT.insertIntoScope(*S1, 2, 1002);
+  EXPECT_EQ(1002U, HT.lookup(*S1, 2));
+
+  {
+    // Re-entering the detached scope shadows the parent's entry again.
+    ScopeTy Reentered(std::move(DS));
+    EXPECT_EQ(1001U, HT.lookup(Reentered, 1));
+    EXPECT_EQ(2002U, HT.lookup(Reentered, 2));
+  }
+
+  EXPECT_EQ(1002U, HT.lookup(*S1, 2));
+  delete S1;
+}
+
@@ -0,0 +1,128 @@
+//===--- CachingMemoryReaderTest.cpp --------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2017 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Remote/CachingMemoryReader.h"
+#include "gtest/gtest.h"
+
+using namespace swift::remote;
+
+namespace {
+
+/// A reader over a single in-memory "mapping", counting underlying reads.
+class MockMemoryReader final : public MemoryReader {
+public:
+  uint64_t Base;
+  std::vector<uint8_t> Memory;
+  unsigned ReadCount = 0;
+
+  MockMemoryReader(uint64_t base, std::vector<uint8_t> memory)
+      : Base(base), Memory(std::move(memory)) {}
+
+  uint8_t getPointerSize() override { return sizeof(void *); }
+  uint8_t getSizeSize() override { return sizeof(size_t); }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return RemoteAddress(nullptr);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    ++ReadCount;
+    uint64_t start = address.getAddressData();
+    if (start < Base || start + size > Base + Memory.size())
+      return false;
+    memcpy(dest, Memory.data() + (start - Base), size);
+    return true;
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    uint64_t cursor = address.getAddressData();
+    dest.clear();
+    while (true) {
+      uint8_t c;
+      if (!readBytes(RemoteAddress(cursor), &c, 1))
+        return false;
+      if (c == 0)
+        return true;
+      dest.push_back(c);
+      ++cursor;
+    }
+  }
+};
+
+const uint64_t PageSize = 4096;
+
+std::vector<uint8_t> patternedMemory(size_t size) {
+  std::vector<uint8_t> memory(size);
+  for (size_t i = 0; i != size; ++i)
+    memory[i] = uint8_t(i * 7 + 3);
+  return memory;
+}
+
+} // end anonymous namespace
+
+TEST(CachingMemoryReader, CachesAtPageGranularity) {
+  auto mock = std::make_shared<MockMemoryReader>(PageSize,
+                                                 patternedMemory(2 * PageSize));
+  CachingMemoryReader reader(mock);
+
+  // Two small reads within one page cost a single underlying read.
+  uint8_t buffer[8];
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(PageSize), buffer, 4));
+  EXPECT_EQ(1u, mock->ReadCount);
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(PageSize + 0x100), buffer, 8));
+  EXPECT_EQ(1u, mock->ReadCount);
+  for (unsigned i = 0; i != 8; ++i)
+    EXPECT_EQ(mock->Memory[0x100 + i], buffer[i]);
+
+  // A read straddling the page boundary pulls in the second page, once.
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(2 * PageSize - 2), buffer, 4));
+  EXPECT_EQ(2u, mock->ReadCount);
+  for (unsigned i = 0; i != 4; ++i)
+    EXPECT_EQ(mock->Memory[PageSize - 2 + i], buffer[i]);
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(2 * PageSize + 8), buffer, 4));
+  EXPECT_EQ(2u, mock->ReadCount);
+}
+
+TEST(CachingMemoryReader, FallsBackWhenPageStraddlesMappingEnd) {
+  // Only 64 readable bytes: whole-page reads fail, exact reads succeed.
+  auto mock = std::make_shared<MockMemoryReader>(PageSize,
+                                                 patternedMemory(64));
+  CachingMemoryReader reader(mock);
+
+  uint8_t buffer[16];
+  EXPECT_TRUE(reader.readBytes(RemoteAddress(PageSize + 16), buffer, 16));
+  for (unsigned i = 0; i != 16; ++i)
+    EXPECT_EQ(mock->Memory[16 + i], buffer[i]);
+
+  // Past the mapping, both the page read and the fallback fail.
+  EXPECT_FALSE(reader.readBytes(RemoteAddress(PageSize + 60), buffer, 16));
+}
+
+TEST(CachingMemoryReader, ReadsStringsThroughTheCache) {
+  auto memory = patternedMemory(PageSize);
+  const char *greeting = "hello";
+  memcpy(memory.data() + 0x20, greeting, strlen(greeting) + 1);
+  auto mock = std::make_shared<MockMemoryReader>(PageSize, std::move(memory));
+  CachingMemoryReader reader(mock);
+
+  std::string result;
+  EXPECT_TRUE(reader.readString(RemoteAddress(PageSize + 0x20), result));
+  EXPECT_EQ("hello", result);
+
+  // The page is already cached; another string read costs no underlying
+  // reads.
+  unsigned readsSoFar = mock->ReadCount;
+  EXPECT_TRUE(reader.readString(RemoteAddress(PageSize + 0x22), result));
+  EXPECT_EQ("llo", result);
+  EXPECT_EQ(readsSoFar, mock->ReadCount);
+}
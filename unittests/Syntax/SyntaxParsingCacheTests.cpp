@@ -0,0 +1,58 @@
+#include "swift/Syntax/RawTokenSyntax.h"
+#include "swift/Syntax/SyntaxParsingCache.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::syntax;
+
+// Build a tree covering the source text "foo bar":
+// (unknown
+//   (token identifier "foo" trailing: Space(1))
+//   (unknown
+//     (token identifier "bar")))
+static RC<RawSyntax> makeFooBarTree() {
+  auto Foo = RawTokenSyntax::make(tok::identifier, "foo",
+                                  SourcePresence::Present, {},
+                                  Trivia::spaces(1));
+  auto Bar = RawTokenSyntax::make(tok::identifier, "bar",
+                                  SourcePresence::Present, {}, {});
+  auto BarParent = RawSyntax::make(SyntaxKind::Unknown, { Bar },
+                                   SourcePresence::Present);
+  return RawSyntax::make(SyntaxKind::Unknown, { Foo, BarParent },
+                         SourcePresence::Present);
+}
+
+TEST(SyntaxParsingCacheTests, FullWidth) {
+  auto Tree = makeFooBarTree();
+  ASSERT_EQ(SyntaxParsingCache::getFullWidth(Tree), size_t(7));
+  ASSERT_EQ(SyntaxParsingCache::getFullWidth(Tree->Layout[0]), size_t(4));
+  ASSERT_EQ(SyntaxParsingCache::getFullWidth(Tree->Layout[1]), size_t(3));
+}
+
+TEST(SyntaxParsingCacheTests, ReuseNodeAfterEdit) {
+  auto Tree = makeFooBarTree();
+  SyntaxParsingCache Cache(Tree);
+  // Replace the first byte by two bytes; "bar" moves from offset 4 to 5.
+  Cache.addEdit(/*Start=*/0, /*End=*/1, /*ReplacementLength=*/2);
+
+  // The node at the edit is damaged and cannot be reused.
+  ASSERT_EQ(Cache.lookUp(0, SyntaxKind::Unknown), nullptr);
+
+  // The subtree after the edit is untouched and gets handed back, both as a
+  // layout node and as a token.
+  ASSERT_EQ(Cache.lookUp(5, SyntaxKind::Unknown), Tree->Layout[1]);
+  ASSERT_EQ(Cache.lookUp(5, SyntaxKind::Token),
+            Tree->Layout[1]->Layout[0]);
+}
+
+TEST(SyntaxParsingCacheTests, NodeTouchingEditIsNotReused) {
+  auto Tree = makeFooBarTree();
+  SyntaxParsingCache Cache(Tree);
+  // Insert a byte right at the boundary between "foo " and "bar".  The lexer
+  // may have joined tokens across the boundary, so neither neighbor can be
+  // reused.
+  Cache.addEdit(/*Start=*/4, /*End=*/4, /*ReplacementLength=*/1);
+
+  ASSERT_EQ(Cache.lookUp(0, SyntaxKind::Token), nullptr);
+  ASSERT_EQ(Cache.lookUp(5, SyntaxKind::Unknown), nullptr);
+}